@@ -0,0 +1,127 @@
+#include "grafico_tendencia.h"
+#include <math.h>
+
+static uint8_t altura_faixa(const grafico_tendencia_t *g) {
+    return (g->pagina_fim - g->pagina_inicio + 1) * 8;
+}
+
+static uint8_t largura_grafico(const grafico_tendencia_t *g) {
+    return (g->ssd->width < GRAFICO_MAX_COLUNAS) ? g->ssd->width : GRAFICO_MAX_COLUNAS;
+}
+
+// Meia altura da escala em ohms: proporcional ao centro, com um mínimo fixo
+// para que leituras de 0 ohm (ou negativas, por ruído) não zerem a escala
+static float meia_faixa(const grafico_tendencia_t *g) {
+    float meia = GRAFICO_MEIA_FAIXA * fabsf(g->centro);
+    return (meia > GRAFICO_MEIA_FAIXA_MIN) ? meia : GRAFICO_MEIA_FAIXA_MIN;
+}
+
+static bool fora_da_escala(const grafico_tendencia_t *g, float valor) {
+    return fabsf(valor - g->centro) > meia_faixa(g);
+}
+
+// Converte uma leitura na linha da faixa (0 = topo), saturando nas bordas
+static int8_t valor_para_y(const grafico_tendencia_t *g, float valor) {
+    float meia = meia_faixa(g);
+    float relativo = (valor - (g->centro - meia)) / (2.0f * meia);
+    if (relativo < 0.0f) relativo = 0.0f;
+    if (relativo > 1.0f) relativo = 1.0f;
+    return (int8_t)lroundf((1.0f - relativo) * (altura_faixa(g) - 1));
+}
+
+// Monta uma coluna da faixa no buffer: eixo central + segmento ligando a
+// leitura da coluna à anterior. Depende só do registro da coluna e da escala,
+// então o redesenho completo reproduz o envio incremental.
+static void desenhar_coluna(grafico_tendencia_t *g, uint8_t x) {
+    const coluna_grafico_t *c = &g->colunas[x];
+    int8_t y0 = -1, y1 = -1;
+    if (!isnan(c->valor)) {
+        y0 = y1 = valor_para_y(g, c->valor);
+        if (!isnan(c->anterior)) {
+            int8_t y_anterior = valor_para_y(g, c->anterior);
+            if (y_anterior < y0) y0 = y_anterior;
+            if (y_anterior > y1) y1 = y_anterior;
+        }
+    }
+    int8_t eixo = altura_faixa(g) / 2;
+
+    for (uint8_t pagina = g->pagina_inicio; pagina <= g->pagina_fim; ++pagina) {
+        uint8_t byte = 0;
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            int8_t linha = (pagina - g->pagina_inicio) * 8 + bit;
+            if ((linha >= y0 && linha <= y1) || linha == eixo) {
+                byte |= (1 << bit);
+            }
+        }
+        g->ssd->ram_buffer[pagina * g->ssd->width + x + 1] = byte;
+    }
+}
+
+// Redesenha todas as colunas na escala atual e envia a faixa inteira
+static void redesenhar_faixa(grafico_tendencia_t *g) {
+    uint8_t largura = largura_grafico(g);
+    for (uint8_t x = 0; x < largura; ++x) {
+        desenhar_coluna(g, x);
+    }
+    ssd1306_send_area(g->ssd, 0, largura - 1, g->pagina_inicio, g->pagina_fim);
+}
+
+void grafico_iniciar(grafico_tendencia_t *g, ssd1306_t *ssd, uint8_t pagina_inicio) {
+    g->ssd = ssd;
+    g->pagina_inicio = pagina_inicio;
+    g->pagina_fim = ssd->pages - 1;
+    for (uint8_t x = 0; x < GRAFICO_MAX_COLUNAS; ++x) {
+        g->colunas[x].valor = NAN;
+        g->colunas[x].anterior = NAN;
+    }
+    g->cursor = 0;
+    g->ultimo_valor = NAN;
+    g->centro = 0;
+    g->redesenhar = true;
+}
+
+void grafico_adicionar(grafico_tendencia_t *g, float valor) {
+    if (!isfinite(valor)) {
+        return;
+    }
+    uint8_t largura = largura_grafico(g);
+    uint8_t x = g->cursor;
+
+    // A leitura ocupa a coluna do cursor; as seguintes viram a lacuna que
+    // separa as leituras novas das antigas
+    g->colunas[x].valor = valor;
+    g->colunas[x].anterior = g->ultimo_valor;
+    for (uint8_t k = 1; k <= GRAFICO_LACUNA; ++k) {
+        coluna_grafico_t *c = &g->colunas[(x + k) % largura];
+        c->valor = NAN;
+        c->anterior = NAN;
+    }
+    g->ultimo_valor = valor;
+    g->cursor = (x + 1) % largura;
+
+    // Fora da escala: recentra e redesenha a faixa inteira (caso raro)
+    if (g->redesenhar || fora_da_escala(g, valor)) {
+        if (fora_da_escala(g, valor)) {
+            g->centro = valor;
+        }
+        redesenhar_faixa(g);
+        g->redesenhar = false;
+        return;
+    }
+
+    // Só a coluna nova e a lacuna, em até duas janelas se passar da borda
+    for (uint8_t k = 0; k <= GRAFICO_LACUNA; ++k) {
+        desenhar_coluna(g, (x + k) % largura);
+    }
+    uint8_t fim = x + GRAFICO_LACUNA;
+    if (fim < largura) {
+        ssd1306_send_area(g->ssd, x, fim, g->pagina_inicio, g->pagina_fim);
+    } else {
+        ssd1306_send_area(g->ssd, x, largura - 1, g->pagina_inicio, g->pagina_fim);
+        ssd1306_send_area(g->ssd, 0, fim - largura, g->pagina_inicio, g->pagina_fim);
+    }
+}
+
+void grafico_invalidar(grafico_tendencia_t *g) {
+    g->redesenhar = true;
+}
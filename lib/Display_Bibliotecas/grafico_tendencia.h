@@ -0,0 +1,42 @@
+#ifndef GRAFICO_TENDENCIA_H
+#define GRAFICO_TENDENCIA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+#define GRAFICO_MAX_COLUNAS 128   // Uma leitura por coluna do display
+#define GRAFICO_LACUNA 2          // Colunas apagadas à frente da leitura mais nova
+#define GRAFICO_MEIA_FAIXA 0.05f  // Escala vertical: centro +- 5%
+#define GRAFICO_MEIA_FAIXA_MIN 0.5f // Meia faixa mínima em ohms (leituras perto de 0)
+
+// Leitura desenhada em uma coluna
+typedef struct {
+    float valor;     // NAN = coluna vazia
+    float anterior;  // Leitura anterior, ligada por um segmento (NAN = nenhuma)
+} coluna_grafico_t;
+
+// Gráfico de tendência em varredura: as páginas acima de pagina_inicio ficam
+// fixas (leitura/escala) e cada leitura ocupa a coluna seguinte da faixa,
+// voltando ao início ao chegar na borda. Só a coluna nova e a lacuna à frente
+// dela são enviadas.
+typedef struct {
+    ssd1306_t *ssd;
+    uint8_t pagina_inicio;                        // Primeira página da faixa do gráfico
+    uint8_t pagina_fim;                           // Última página da faixa do gráfico
+    coluna_grafico_t colunas[GRAFICO_MAX_COLUNAS]; // Indexadas pela coluna do display
+    uint8_t cursor;                               // Coluna da próxima leitura
+    float ultimo_valor;                           // Leitura mais nova (NAN = nenhuma)
+    float centro;                                 // Valor no eixo central
+    bool redesenhar;                              // Força envio completo da faixa
+} grafico_tendencia_t;
+
+void grafico_iniciar(grafico_tendencia_t *g, ssd1306_t *ssd, uint8_t pagina_inicio);
+// Adiciona uma leitura: desenha e envia a coluna dela e a lacuna à frente,
+// ou redesenha a faixa se a leitura sair da escala atual. Leituras não
+// finitas são ignoradas.
+void grafico_adicionar(grafico_tendencia_t *g, float valor);
+// Marca a faixa para redesenho (ex.: depois de redesenhar a tela inteira)
+void grafico_invalidar(grafico_tendencia_t *g);
+
+#endif // GRAFICO_TENDENCIA_H
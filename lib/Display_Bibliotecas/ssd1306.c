@@ -1,17 +1,47 @@
 #include "ssd1306.h"
 #include "font.h"
 #include <stdlib.h>
+#include <string.h>
 #include "hardware/i2c.h"
 
+// Acesso à geometria: constantes no modo fixo, campos da struct no modo dinâmico
+#ifdef SSD1306_FIXED
+#define SSD_WIDTH(ssd)   SSD1306_WIDTH
+#define SSD_HEIGHT(ssd)  SSD1306_HEIGHT
+#define SSD_PAGES(ssd)   SSD1306_PAGES
+#define SSD_BUFSIZE(ssd) SSD1306_BUFSIZE
+#define SSD_COM_PINS     (SSD1306_HEIGHT == 32 ? 0x02 : 0x12)
+
+// Framebuffer estático (.bss), já com o byte de prefixo de dados
+static uint8_t ssd1306_buffer[SSD1306_BUFSIZE];
+#else
+#define SSD_WIDTH(ssd)   ((ssd)->width)
+#define SSD_HEIGHT(ssd)  ((ssd)->height)
+#define SSD_PAGES(ssd)   ((ssd)->pages)
+#define SSD_BUFSIZE(ssd) ((ssd)->bufsize)
+#define SSD_COM_PINS     0x12
+#endif
+
 // Inicializa o display SSD1306
+// No modo de geometria fixa, width/height são ignorados em favor do preset
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+#ifdef SSD1306_FIXED
+    (void)width;
+    (void)height;
+    ssd->width = SSD1306_WIDTH;
+    ssd->height = SSD1306_HEIGHT;
+    ssd->pages = SSD1306_PAGES;
+    ssd->bufsize = SSD1306_BUFSIZE;
+    ssd->ram_buffer = ssd1306_buffer;
+#else
     ssd->width = width;
     ssd->height = height;
     ssd->pages = height / 8;
-    ssd->address = address;
-    ssd->i2c_port = i2c;
     ssd->bufsize = ssd->pages * ssd->width + 1;
     ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+#endif
+    ssd->address = address;
+    ssd->i2c_port = i2c;
     if (ssd->ram_buffer != NULL) {
         ssd->ram_buffer[0] = 0x40; // Co = 0, D/C = 1 (Data Continuation)
     }
@@ -26,12 +56,12 @@ void ssd1306_config(ssd1306_t *ssd) {
     ssd1306_command(ssd, 0x40); // Linha inicial
     ssd1306_command(ssd, 0xA1); // Remapeamento de segmentos
     ssd1306_command(ssd, 0xA8); // Razão de multiplexação
-    ssd1306_command(ssd, ssd->height - 1);
+    ssd1306_command(ssd, SSD_HEIGHT(ssd) - 1);
     ssd1306_command(ssd, 0xC8); // Direção de varredura COM
     ssd1306_command(ssd, 0xD3); // Deslocamento do display
     ssd1306_command(ssd, 0x00);
     ssd1306_command(ssd, 0xDA); // Configuração de pinos COM
-    ssd1306_command(ssd, 0x12);
+    ssd1306_command(ssd, SSD_COM_PINS);
     ssd1306_command(ssd, 0xD5); // Divisor de clock
     ssd1306_command(ssd, 0x80);
     ssd1306_command(ssd, 0xD9); // Período de pré-carga
@@ -57,16 +87,49 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
 void ssd1306_send_data(ssd1306_t *ssd) {
     ssd1306_command(ssd, 0x21); // Endereço de coluna
     ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->width - 1);
+    ssd1306_command(ssd, SSD_WIDTH(ssd) - 1);
     ssd1306_command(ssd, 0x22); // Endereço de página
     ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->pages - 1);
-    i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false);
+    ssd1306_command(ssd, SSD_PAGES(ssd) - 1);
+    i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->ram_buffer, SSD_BUFSIZE(ssd), false);
+}
+
+// Envia apenas uma janela do buffer (colunas col0..col1, páginas page0..page1)
+void ssd1306_send_area(ssd1306_t *ssd, uint8_t col0, uint8_t col1, uint8_t page0, uint8_t page1) {
+    uint8_t chunk[129]; // Prefixo 0x40 + até 128 bytes de dados
+    uint8_t width = col1 - col0 + 1;
+
+    ssd1306_command(ssd, 0x21); // Endereço de coluna
+    ssd1306_command(ssd, col0);
+    ssd1306_command(ssd, col1);
+    ssd1306_command(ssd, 0x22); // Endereço de página
+    ssd1306_command(ssd, page0);
+    ssd1306_command(ssd, page1);
+
+    // Na janela o endereçamento horizontal passa sozinho para a página
+    // seguinte, então várias páginas estreitas cabem em uma só transação
+    chunk[0] = 0x40;
+    uint8_t len = 1;
+    for (uint8_t page = page0; page <= page1; ++page) {
+        if (len + width > sizeof(chunk)) {
+            i2c_write_blocking(ssd->i2c_port, ssd->address, chunk, len, false);
+            len = 1;
+        }
+        memcpy(&chunk[len], &ssd->ram_buffer[page * SSD_WIDTH(ssd) + col0 + 1], width);
+        len += width;
+    }
+    i2c_write_blocking(ssd->i2c_port, ssd->address, chunk, len, false);
 }
 
 // Desenha um pixel
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
-    uint16_t index = (y / 8) * ssd->width + x + 1;
+#ifdef SSD1306_FIXED
+    // Recorte contra a geometria constante: protege o buffer estático
+    if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT) {
+        return;
+    }
+#endif
+    uint16_t index = (y / 8) * SSD_WIDTH(ssd) + x + 1;
     uint8_t pixel = y % 8;
     if (value) {
         ssd->ram_buffer[index] |= (1 << pixel);
@@ -77,11 +140,16 @@ void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
 
 // Preenche a tela (tudo ligado ou desligado)
 void ssd1306_fill(ssd1306_t *ssd, bool value) {
+#ifdef SSD1306_FIXED
+    // Tamanho conhecido: preenche o buffer inteiro de uma vez, preservando o prefixo
+    memset(ssd->ram_buffer + 1, value ? 0xFF : 0x00, SSD1306_BUFSIZE - 1);
+#else
     for (uint8_t y = 0; y < ssd->height; ++y) {
         for (uint8_t x = 0; x < ssd->width; ++x) {
             ssd1306_pixel(ssd, x, y, value);
         }
     }
+#endif
 }
 
 // Desenha números pequenos (5x5 pixels)
@@ -156,10 +224,10 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y,
         }
 
         // Quebra de linha automática
-        if (x + char_width > ssd->width) {
+        if (x + char_width > SSD_WIDTH(ssd)) {
             x = 0;
             y += 8;
-            if (y + 8 > ssd->height) break;
+            if (y + 8 > SSD_HEIGHT(ssd)) break;
         }
 
         ssd1306_draw_char(ssd, c, x, y, use_small_numbers);
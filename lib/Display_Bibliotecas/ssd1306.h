@@ -5,6 +5,20 @@
 #include <stdbool.h>
 #include "hardware/i2c.h"
 
+// Geometria fixa em tempo de compilação (opção SSD1306_GEOMETRIA_FIXA no CMake).
+// Com SSD1306_FIXED_WIDTH/SSD1306_FIXED_HEIGHT definidos, o framebuffer fica
+// estático no .bss e os cálculos de índice viram constantes e deslocamentos.
+#if defined(SSD1306_FIXED_WIDTH) && defined(SSD1306_FIXED_HEIGHT)
+#define SSD1306_FIXED   1
+#define SSD1306_WIDTH   SSD1306_FIXED_WIDTH
+#define SSD1306_HEIGHT  SSD1306_FIXED_HEIGHT
+#define SSD1306_PAGES   (SSD1306_HEIGHT / 8)
+#define SSD1306_BUFSIZE (SSD1306_PAGES * SSD1306_WIDTH + 1) // +1 para o prefixo 0x40
+
+_Static_assert(SSD1306_WIDTH == 128, "SSD1306: apenas largura de 128 colunas suportada");
+_Static_assert(SSD1306_HEIGHT == 64 || SSD1306_HEIGHT == 32, "SSD1306: presets 128x64 ou 128x32");
+#endif
+
 typedef struct {
     uint8_t width;
     uint8_t height;
@@ -21,6 +35,7 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_send_area(ssd1306_t *ssd, uint8_t col0, uint8_t col1, uint8_t page0, uint8_t page1);
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
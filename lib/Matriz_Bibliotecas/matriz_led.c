@@ -9,7 +9,7 @@ typedef struct {
     uint8_t b;
 } CorRGB;
 
-// Paleta de cores para as faixas 
+// Paleta de cores para as faixas (a ordem é o índice usado em mostrar_codigo_cores)
 const CorRGB PALETA_CORES[] = {
     {"Preto", 0, 0, 0}, //cor preta não tem valor rgb
     {"Marrom",   30,   10,    10},  
@@ -57,7 +57,14 @@ uint32_t nome_cor_para_grb(const char *nome) {
 void inicializar_matriz_led() {
     PIO pio = pio0;
     uint offset = pio_add_program(pio, &ws2812_program);
-    ws2812_program_init(pio, 0, offset, PINO_WS2812, 800000, RGBW_ATIVO);
+    ws2812_program_init(pio, 0, offset, PINO_WS2812, FREQ_WS2812, RGBW_ATIVO);
+}
+
+// Mesmo cálculo de ws2812_program_init, aplicado com a state machine já rodando
+void atualizar_clock_matriz() {
+    int ciclos_por_bit = ws2812_T1 + ws2812_T2 + ws2812_T3;
+    float div = clock_get_hz(clk_sys) / ((float)FREQ_WS2812 * ciclos_por_bit);
+    pio_sm_set_clkdiv(pio0, 0, div);
 }
 
 // Mostra as cores das faixas nas linhas corretas (1ª e 5ª invertidas)
@@ -85,6 +92,24 @@ void mostrar_faixas_cores(const char *cor_faixa1, const char *cor_faixa2, const
     sleep_us(100); // Pequeno delay opcional
 }
 
+// Mostra o código de cores completo, uma faixa por linha, sem busca por nome
+void mostrar_codigo_cores(const uint8_t *faixas, uint8_t num_faixas) {
+    uint32_t grb_linhas[NUM_LINHAS] = {0};
+
+    // Faixa k vai para a linha física (NUM_LINHAS - k), mantendo a 1ª faixa embaixo
+    for (int k = 0; k < num_faixas && k < NUM_LINHAS; ++k) {
+        if (faixas[k] < NUM_PALETA) {
+            const CorRGB *cor = &PALETA_CORES[faixas[k]];
+            grb_linhas[NUM_LINHAS - 1 - k] = rgb_para_uint32(cor->r, cor->g, cor->b);
+        }
+    }
+
+    for (int i = 0; i < NUM_PIXELS; i++) {
+        enviar_pixel(grb_linhas[i / NUM_COLUNAS]);
+    }
+    sleep_us(100); // Pequeno delay opcional
+}
+
 // Desliga todos os LEDs da matriz
 void desligar_matriz() {
     for (int i = 0; i < NUM_PIXELS; i++) {
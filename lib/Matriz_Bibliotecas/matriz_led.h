@@ -10,10 +10,16 @@
 #define NUM_COLUNAS   5   // Dimensão da matriz
 #define NUM_PIXELS    (NUM_LINHAS * NUM_COLUNAS) // Total 25
 #define RGBW_ATIVO    false // Se os LEDs são RGBW ou RGB
+#define FREQ_WS2812   800000 // Frequência de bit do protocolo WS2812 (Hz)
 
 void inicializar_matriz_led();
+// Recalcula o divisor de clock da PIO após mudança de clk_sys
+void atualizar_clock_matriz();
 // Parâmetros: Ponteiros para os nomes das cores (ex: "Vermelho")
 void mostrar_faixas_cores(const char *cor_faixa1, const char *cor_faixa2, const char *cor_faixa3);
+// Mostra até 5 faixas, uma por linha (1ª faixa na linha física 5)
+// Parâmetros: índices na paleta (0-9 dígitos, 10 prata, 11 ouro, 12 apagado)
+void mostrar_codigo_cores(const uint8_t *faixas, uint8_t num_faixas);
 // Função para desligar todos os LEDs da matriz
 void desligar_matriz();
 #endif // MATRIZ_LED_H
\ No newline at end of file
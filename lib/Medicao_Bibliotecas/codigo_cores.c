@@ -0,0 +1,167 @@
+#include "codigo_cores.h"
+#include <math.h>
+
+// Faixa de multiplicadores codificáveis: 10^-2 (prata) até 10^9 (branco)
+#define MULT_MIN (-2)
+#define MULT_MAX 9
+
+// Potências de 10 a partir de 10^(MULT_MIN - 1): a década abaixo da faixa
+// ainda pode arredondar para o primeiro valor codificável
+static const float POTENCIAS_10[MULT_MAX - MULT_MIN + 2] = {
+    1e-3f, 1e-2f, 1e-1f, 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f
+};
+#define POT10(m) POTENCIAS_10[(m) - MULT_MIN + 1]
+
+// Série E24 (2 dígitos significativos)
+static const uint16_t VALORES_E24[24] = {
+    10, 11, 12, 13, 15, 16, 18, 20,
+    22, 24, 27, 30, 33, 36, 39, 43,
+    47, 51, 56, 62, 68, 75, 82, 91
+};
+
+// Série E192 (3 dígitos significativos); a E96 são os índices pares
+static const uint16_t VALORES_E192[192] = {
+    100, 101, 102, 104, 105, 106, 107, 109, 110, 111, 113, 114,
+    115, 117, 118, 120, 121, 123, 124, 126, 127, 129, 130, 132,
+    133, 135, 137, 138, 140, 142, 143, 145, 147, 149, 150, 152,
+    154, 156, 158, 160, 162, 164, 165, 167, 169, 172, 174, 176,
+    178, 180, 182, 184, 187, 189, 191, 193, 196, 198, 200, 203,
+    205, 208, 210, 213, 215, 218, 221, 223, 226, 229, 232, 234,
+    237, 240, 243, 246, 249, 252, 255, 258, 261, 264, 267, 271,
+    274, 277, 280, 284, 287, 291, 294, 298, 301, 305, 309, 312,
+    316, 320, 324, 328, 332, 336, 340, 344, 348, 352, 357, 361,
+    365, 370, 374, 379, 383, 388, 392, 397, 402, 407, 412, 417,
+    422, 427, 432, 437, 442, 448, 453, 459, 464, 470, 475, 481,
+    487, 493, 499, 505, 511, 517, 523, 530, 536, 542, 549, 556,
+    562, 569, 576, 583, 590, 597, 604, 612, 619, 626, 634, 642,
+    649, 657, 665, 673, 681, 690, 698, 706, 715, 723, 732, 741,
+    750, 759, 768, 777, 787, 796, 806, 816, 825, 835, 845, 856,
+    866, 876, 887, 898, 909, 920, 931, 942, 953, 965, 976, 988
+};
+
+// Descrição de cada série para o codificador
+typedef struct {
+    const uint16_t *valores;
+    uint8_t quantidade;  // Valores por década
+    uint8_t passo;       // Passo na tabela (E96 usa a E192 de 2 em 2)
+    uint8_t digitos;     // Dígitos significativos
+    uint8_t tolerancia;  // Cor da faixa de tolerância
+    const char *nome;
+} serie_info_t;
+
+static const serie_info_t SERIES[NUM_SERIES] = {
+    [SERIE_E24]  = {VALORES_E24,  24,  1, 2, COR_OURO,   "E24"},
+    [SERIE_E96]  = {VALORES_E192, 96,  2, 3, COR_MARROM, "E96"},
+    [SERIE_E192] = {VALORES_E192, 192, 1, 3, COR_VERDE,  "E192"},
+};
+
+// Nomes das cores, indexados por cor_faixa_t
+static const char *NOMES_CORES[COR_NENHUMA] = {
+    "Preto", "Marrom", "Vermelho", "Laranja", "Amarelo",
+    "Verde", "Azul", "Violeta", "Cinza", "Branco", "Prata", "Ouro"
+};
+
+static const char *ABREVIACOES_CORES[COR_NENHUMA] = {
+    "Pre", "Mar", "Vrm", "Lar", "Ama",
+    "Vrd", "Azu", "Vio", "Cin", "Bra", "Pra", "Our"
+};
+
+static inline uint16_t valor_serie(const serie_info_t *s, uint16_t i) {
+    return s->valores[i * s->passo];
+}
+
+bool codificar_resistor(float resistencia, serie_e_t serie, codigo_resistor_t *codigo) {
+    codigo->valor = 0;
+    codigo->num_faixas = 0;
+    for (int i = 0; i < MAX_FAIXAS; ++i) {
+        codigo->faixas[i] = COR_NENHUMA;
+    }
+
+    if (serie >= NUM_SERIES || !isfinite(resistencia) || resistencia <= 0) {
+        return false;
+    }
+    const serie_info_t *s = &SERIES[serie];
+    float base_min = (s->digitos == 2) ? 10.0f : 100.0f; // Menor mantissa da década
+
+    // Normaliza para mantissa com 'digitos' algarismos antes da vírgula
+    int mult = (int)floorf(log10f(resistencia)) - (s->digitos - 1);
+    if (mult < MULT_MIN - 1 || mult > MULT_MAX) {
+        return false;
+    }
+    float mantissa = resistencia / POT10(mult);
+    if (mantissa >= base_min * 10.0f && mult < MULT_MAX) { // Correção de arredondamento do log10f
+        mult++;
+        mantissa = resistencia / POT10(mult);
+    } else if (mantissa < base_min && mult > MULT_MIN - 1) {
+        mult--;
+        mantissa = resistencia / POT10(mult);
+    }
+
+    // Busca binária pelo primeiro valor da série >= mantissa
+    uint16_t lo = 0, hi = s->quantidade;
+    while (lo < hi) {
+        uint16_t meio = (lo + hi) / 2;
+        if (valor_serie(s, meio) < mantissa) {
+            lo = meio + 1;
+        } else {
+            hi = meio;
+        }
+    }
+
+    // Escolhe o vizinho mais próximo em escala logarítmica:
+    // m/inf < sup/m  <=>  m^2 < inf*sup
+    uint16_t base;
+    if (lo == 0) {
+        base = valor_serie(s, 0);
+    } else {
+        float inferior = valor_serie(s, lo - 1);
+        float superior = (lo < s->quantidade) ? valor_serie(s, lo) : base_min * 10.0f;
+        if (mantissa * mantissa <= inferior * superior) {
+            base = (uint16_t)inferior;
+        } else if (lo < s->quantidade) {
+            base = (uint16_t)superior;
+        } else { // Passa para o primeiro valor da década seguinte
+            base = (uint16_t)base_min;
+            mult++;
+        }
+    }
+    if (mult < MULT_MIN || mult > MULT_MAX) {
+        return false;
+    }
+
+    // Dígitos significativos
+    uint8_t n = 0;
+    if (s->digitos == 3) {
+        codigo->faixas[n++] = base / 100;
+    }
+    codigo->faixas[n++] = (base / 10) % 10;
+    codigo->faixas[n++] = base % 10;
+
+    // Multiplicador: 10^-2 prata, 10^-1 ouro, 10^0..10^9 preto..branco
+    if (mult == -2) {
+        codigo->faixas[n++] = COR_PRATA;
+    } else if (mult == -1) {
+        codigo->faixas[n++] = COR_OURO;
+    } else {
+        codigo->faixas[n++] = (uint8_t)mult;
+    }
+
+    // Tolerância
+    codigo->faixas[n++] = s->tolerancia;
+
+    codigo->num_faixas = n;
+    codigo->valor = base * POT10(mult);
+    return true;
+}
+
+const char *nome_cor(uint8_t cor) {
+    return (cor < COR_NENHUMA) ? NOMES_CORES[cor] : "---";
+}
+
+const char *abreviacao_cor(uint8_t cor) {
+    return (cor < COR_NENHUMA) ? ABREVIACOES_CORES[cor] : "---";
+}
+
+const char *nome_serie(serie_e_t serie) {
+    return (serie < NUM_SERIES) ? SERIES[serie].nome : "---";
+}
@@ -0,0 +1,53 @@
+#ifndef CODIGO_CORES_H
+#define CODIGO_CORES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Cores das faixas, na mesma ordem da paleta da matriz de LEDs
+// (0-9 são os dígitos do código de cores)
+typedef enum {
+    COR_PRETO = 0,
+    COR_MARROM,
+    COR_VERMELHO,
+    COR_LARANJA,
+    COR_AMARELO,
+    COR_VERDE,
+    COR_AZUL,
+    COR_VIOLETA,
+    COR_CINZA,
+    COR_BRANCO,
+    COR_PRATA,
+    COR_OURO,
+    COR_NENHUMA
+} cor_faixa_t;
+
+// Séries E suportadas
+typedef enum {
+    SERIE_E24 = 0,  // 2 dígitos, 5%   -> código de 4 faixas
+    SERIE_E96,      // 3 dígitos, 1%   -> código de 5 faixas
+    SERIE_E192,     // 3 dígitos, 0,5% -> código de 5 faixas
+    NUM_SERIES
+} serie_e_t;
+
+#define MAX_FAIXAS 5
+
+// Código de cores de um resistor comercial
+typedef struct {
+    float valor;                 // Valor nominal da série em ohms
+    uint8_t num_faixas;          // 4 ou 5
+    uint8_t faixas[MAX_FAIXAS];  // Dígitos, multiplicador e tolerância (cor_faixa_t)
+} codigo_resistor_t;
+
+// Aproxima a resistência ao valor mais próximo da série (comparação logarítmica)
+// e monta o código de cores. Retorna false se a resistência não for codificável.
+bool codificar_resistor(float resistencia, serie_e_t serie, codigo_resistor_t *codigo);
+
+// Nome completo e abreviação (3 letras) de uma cor; "---" se inválida
+const char *nome_cor(uint8_t cor);
+const char *abreviacao_cor(uint8_t cor);
+
+// Nome da série ("E24", "E96", "E192")
+const char *nome_serie(serie_e_t serie);
+
+#endif // CODIGO_CORES_H
@@ -0,0 +1,23 @@
+#include "estatistica.h"
+#include <math.h>
+
+void estatistica_iniciar(estatistica_t *est) {
+    est->n = 0;
+    est->media = 0;
+    est->m2 = 0;
+}
+
+void estatistica_adicionar(estatistica_t *est, float amostra) {
+    est->n++;
+    float delta = amostra - est->media;
+    est->media += delta / est->n;
+    est->m2 += delta * (amostra - est->media);
+}
+
+float estatistica_variancia(const estatistica_t *est) {
+    return (est->n > 1) ? est->m2 / (est->n - 1) : 0.0f;
+}
+
+float estatistica_incerteza_media(const estatistica_t *est) {
+    return (est->n > 0) ? sqrtf(estatistica_variancia(est) / est->n) : 0.0f;
+}
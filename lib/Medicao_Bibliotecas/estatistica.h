@@ -0,0 +1,21 @@
+#ifndef ESTATISTICA_H
+#define ESTATISTICA_H
+
+#include <stdint.h>
+
+// Média e variância acumuladas amostra a amostra (algoritmo de Welford),
+// sem guardar o bloco de leituras
+typedef struct {
+    uint32_t n;
+    float media;
+    float m2;  // Soma dos quadrados dos desvios em relação à média
+} estatistica_t;
+
+void estatistica_iniciar(estatistica_t *est);
+void estatistica_adicionar(estatistica_t *est, float amostra);
+// Variância amostral (n - 1); 0 com menos de 2 amostras
+float estatistica_variancia(const estatistica_t *est);
+// Incerteza padrão da média (desvio padrão / sqrt(n))
+float estatistica_incerteza_media(const estatistica_t *est);
+
+#endif // ESTATISTICA_H
@@ -0,0 +1,282 @@
+#include "comandos.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "perfil_desempenho.h"
+#include "../Medicao_Bibliotecas/codigo_cores.h"
+
+// Parâmetros acessíveis por get/set
+typedef enum {
+    PARAM_AMOSTRAS = 0,
+    PARAM_RCONHECIDO,
+    PARAM_SERIE,
+    PARAM_LIMITE,
+    PARAM_INTERVALO,
+    PARAM_PERFIL,
+    PARAM_MODO,
+    NUM_PARAMETROS
+} parametro_t;
+
+static const char *NOMES_PARAMETROS[NUM_PARAMETROS] = {
+    "amostras", "rconhecido", "serie", "limite", "intervalo", "perfil", "modo"
+};
+
+static const char *NOMES_PERFIS[NUM_PERFIS] = {"rapido", "equilibrado", "economico"};
+static const char *NOMES_MODOS[2] = {"numerico", "grafico"};
+
+// --- Leitura de linha ---
+
+void leitor_iniciar(leitor_linha_t *leitor) {
+    leitor->tamanho = 0;
+    leitor->estourou = false;
+    leitor->linha[0] = '\0';
+}
+
+bool leitor_adicionar(leitor_linha_t *leitor, int c) {
+    // CR (PuTTY, minicom, picocom), LF ou CRLF: o LF do par chega numa linha vazia
+    if (c == '\n' || c == '\r') {
+        bool completa = !leitor->estourou && leitor->tamanho > 0;
+        leitor->linha[leitor->tamanho] = '\0';
+        leitor->tamanho = 0;
+        leitor->estourou = false;
+        return completa;
+    }
+    if (c == '\b' || c == 0x7F) { // Backspace do terminal
+        if (leitor->tamanho > 0) {
+            leitor->tamanho--;
+        }
+        return false;
+    }
+    if (c == '\t') { // Tab separa tokens como o espaço
+        c = ' ';
+    }
+    if (c < 0x20 || c > 0x7E) { // Ignora os demais caracteres de controle
+        return false;
+    }
+    if (leitor->tamanho >= TAM_LINHA_COMANDO - 1) {
+        leitor->estourou = true;
+        return false;
+    }
+    leitor->linha[leitor->tamanho++] = (char)tolower(c);
+    return false;
+}
+
+// --- Funções Internas ---
+
+// Separa o próximo token delimitado por espaços (modifica a string)
+static char *proximo_token(char **cursor) {
+    char *p = *cursor;
+    while (*p == ' ' || *p == '\t') {
+        p++;
+    }
+    if (*p == '\0') {
+        *cursor = p;
+        return NULL;
+    }
+    char *inicio = p;
+    while (*p != '\0' && *p != ' ' && *p != '\t') {
+        p++;
+    }
+    if (*p != '\0') {
+        *p++ = '\0';
+    }
+    *cursor = p;
+    return inicio;
+}
+
+static bool igual_sem_caixa(const char *a, const char *b) {
+    while (*a && *b) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) {
+            return false;
+        }
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+// Procura um nome em uma tabela; retorna o índice ou -1
+static int buscar_nome(const char *nome, const char *const *tabela, int quantidade) {
+    for (int i = 0; i < quantidade; ++i) {
+        if (igual_sem_caixa(nome, tabela[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool converter_inteiro(const char *texto, unsigned long *valor) {
+    char *fim;
+    if (!isdigit((unsigned char)*texto)) {
+        return false;
+    }
+    *valor = strtoul(texto, &fim, 10);
+    return *fim == '\0';
+}
+
+static bool converter_float(const char *texto, float *valor) {
+    char *fim;
+    *valor = strtof(texto, &fim);
+    return fim != texto && *fim == '\0';
+}
+
+// Escreve "nome=valor" no buffer
+static int formatar_parametro(const configuracao_t *cfg, parametro_t p, char *buffer, size_t tamanho) {
+    const char *nome = NOMES_PARAMETROS[p];
+    switch (p) {
+    case PARAM_AMOSTRAS:
+        return snprintf(buffer, tamanho, "%s=%u", nome, (unsigned)cfg->num_amostras);
+    case PARAM_RCONHECIDO:
+        return snprintf(buffer, tamanho, "%s=%.7g", nome, cfg->resistor_conhecido);
+    case PARAM_SERIE:
+        return snprintf(buffer, tamanho, "%s=%s", nome, nome_serie((serie_e_t)cfg->serie));
+    case PARAM_LIMITE:
+        return snprintf(buffer, tamanho, "%s=%.7g", nome, cfg->limite_aberto);
+    case PARAM_INTERVALO:
+        return snprintf(buffer, tamanho, "%s=%lu", nome, (unsigned long)cfg->intervalo_ms);
+    case PARAM_PERFIL:
+        return snprintf(buffer, tamanho, "%s=%s", nome, cfg->perfil < NUM_PERFIS ? NOMES_PERFIS[cfg->perfil] : "---");
+    case PARAM_MODO:
+        return snprintf(buffer, tamanho, "%s=%s", nome, NOMES_MODOS[cfg->modo_grafico ? 1 : 0]);
+    default:
+        return snprintf(buffer, tamanho, "%s=?", nome);
+    }
+}
+
+// Atribui um valor textual; só altera cfg se o resultado for válido
+static bool atribuir_parametro(configuracao_t *cfg, parametro_t p, const char *texto) {
+    configuracao_t nova = *cfg;
+    unsigned long inteiro;
+    float real;
+    int indice;
+
+    switch (p) {
+    case PARAM_AMOSTRAS:
+        if (!converter_inteiro(texto, &inteiro) || inteiro > AMOSTRAS_MAX) return false;
+        nova.num_amostras = (uint16_t)inteiro;
+        break;
+    case PARAM_RCONHECIDO:
+        if (!converter_float(texto, &real)) return false;
+        nova.resistor_conhecido = real;
+        break;
+    case PARAM_SERIE:
+        for (indice = 0; indice < NUM_SERIES; ++indice) {
+            if (igual_sem_caixa(texto, nome_serie((serie_e_t)indice))) break;
+        }
+        if (indice == NUM_SERIES) return false;
+        nova.serie = (uint8_t)indice;
+        break;
+    case PARAM_LIMITE:
+        if (!converter_float(texto, &real)) return false;
+        nova.limite_aberto = real;
+        break;
+    case PARAM_INTERVALO:
+        if (!converter_inteiro(texto, &inteiro) || inteiro > INTERVALO_MAX_MS) return false;
+        nova.intervalo_ms = (uint32_t)inteiro;
+        break;
+    case PARAM_PERFIL:
+        indice = buscar_nome(texto, NOMES_PERFIS, NUM_PERFIS);
+        if (indice < 0) return false;
+        nova.perfil = (uint8_t)indice;
+        break;
+    case PARAM_MODO:
+        indice = buscar_nome(texto, NOMES_MODOS, 2);
+        if (indice < 0) return false;
+        nova.modo_grafico = (uint8_t)indice;
+        break;
+    default:
+        return false;
+    }
+
+    if (!configuracao_valida(&nova)) {
+        return false;
+    }
+    *cfg = nova;
+    return true;
+}
+
+// --- Funções Públicas ---
+
+resultado_comando_t executar_comando(const char *linha, configuracao_t *pendente, char *resposta, size_t tamanho) {
+    char copia[TAM_LINHA_COMANDO];
+    strncpy(copia, linha, sizeof(copia) - 1);
+    copia[sizeof(copia) - 1] = '\0';
+
+    char *cursor = copia;
+    char *comando = proximo_token(&cursor);
+    char *nome = proximo_token(&cursor);
+    char *valor = proximo_token(&cursor);
+    char *extra = proximo_token(&cursor);
+    int parametro = nome ? buscar_nome(nome, NOMES_PARAMETROS, NUM_PARAMETROS) : -1;
+
+    if (comando == NULL) {
+        snprintf(resposta, tamanho, "erro: linha vazia");
+        return COMANDO_ERRO;
+    }
+
+    if (igual_sem_caixa(comando, "get")) {
+        if (valor != NULL) {
+            snprintf(resposta, tamanho, "erro: uso get [parametro]");
+            return COMANDO_ERRO;
+        }
+        if (nome == NULL) { // Todos os parâmetros
+            size_t usado = 0;
+            for (int p = 0; p < NUM_PARAMETROS && usado < tamanho; ++p) {
+                int n = formatar_parametro(pendente, (parametro_t)p, resposta + usado, tamanho - usado);
+                if (n < 0) break;
+                usado += (size_t)n;
+                if (p < NUM_PARAMETROS - 1 && usado + 1 < tamanho) {
+                    resposta[usado++] = ' ';
+                    resposta[usado] = '\0';
+                }
+            }
+            return COMANDO_CONSULTA;
+        }
+        if (parametro < 0) {
+            snprintf(resposta, tamanho, "erro: parametro desconhecido '%s'", nome);
+            return COMANDO_ERRO;
+        }
+        formatar_parametro(pendente, (parametro_t)parametro, resposta, tamanho);
+        return COMANDO_CONSULTA;
+    }
+
+    if (igual_sem_caixa(comando, "set")) {
+        if (nome == NULL || valor == NULL || extra != NULL) {
+            snprintf(resposta, tamanho, "erro: uso set <parametro> <valor>");
+            return COMANDO_ERRO;
+        }
+        if (parametro < 0) {
+            snprintf(resposta, tamanho, "erro: parametro desconhecido '%s'", nome);
+            return COMANDO_ERRO;
+        }
+        if (!atribuir_parametro(pendente, (parametro_t)parametro, valor)) {
+            snprintf(resposta, tamanho, "erro: valor invalido '%s' para %s", valor, nome);
+            return COMANDO_ERRO;
+        }
+        int n = snprintf(resposta, tamanho, "ok ");
+        formatar_parametro(pendente, (parametro_t)parametro, resposta + n, tamanho - n);
+        return COMANDO_ALTERADO;
+    }
+
+    if (igual_sem_caixa(comando, "save") && nome == NULL) {
+        snprintf(resposta, tamanho, "ok gravando");
+        return COMANDO_SALVAR;
+    }
+
+    if (igual_sem_caixa(comando, "padrao") && nome == NULL) {
+        configuracao_padrao(pendente);
+        snprintf(resposta, tamanho, "ok valores de fabrica (save para gravar)");
+        return COMANDO_ALTERADO;
+    }
+
+    if ((igual_sem_caixa(comando, "help") || igual_sem_caixa(comando, "?")) && nome == NULL) {
+        snprintf(resposta, tamanho,
+                 "get [param] | set <param> <valor> | save | padrao; "
+                 "params: amostras rconhecido serie limite intervalo perfil modo");
+        return COMANDO_CONSULTA;
+    }
+
+    snprintf(resposta, tamanho, "erro: comando desconhecido '%s'", comando);
+    return COMANDO_ERRO;
+}
@@ -0,0 +1,34 @@
+#ifndef COMANDOS_H
+#define COMANDOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuracao.h"
+
+#define TAM_LINHA_COMANDO 64
+
+// Acumula caracteres da serial até o fim de linha, sem bloquear
+typedef struct {
+    char linha[TAM_LINHA_COMANDO];
+    uint8_t tamanho;
+    bool estourou;  // Linha longa demais: descarta até o próximo '\n'
+} leitor_linha_t;
+
+typedef enum {
+    COMANDO_CONSULTA = 0,  // get/help: nada mudou
+    COMANDO_ALTERADO,      // Configuração pendente modificada
+    COMANDO_SALVAR,        // Aplicar e gravar na flash
+    COMANDO_ERRO
+} resultado_comando_t;
+
+void leitor_iniciar(leitor_linha_t *leitor);
+// Alimenta um caractere; retorna true quando leitor->linha contém uma linha
+// completa (terminada por CR, LF ou CRLF)
+bool leitor_adicionar(leitor_linha_t *leitor, int c);
+
+// Interpreta uma linha sobre a configuração pendente e escreve a resposta.
+// Comandos: get [param], set <param> <valor>, save, padrao, help
+resultado_comando_t executar_comando(const char *linha, configuracao_t *pendente, char *resposta, size_t tamanho);
+
+#endif // COMANDOS_H
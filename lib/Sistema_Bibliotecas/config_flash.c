@@ -0,0 +1,69 @@
+#include "config_flash.h"
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#define CONFIG_MAGICA 0x4F484D43u  // "OHMC"
+#define CONFIG_VERSAO 1
+#define CONFIG_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE) // Último setor
+
+// Registro gravado no início do setor
+typedef struct {
+    uint32_t magica;
+    uint16_t versao;
+    uint16_t tamanho;
+    configuracao_t dados;
+    uint32_t checksum;
+} registro_config_t;
+
+_Static_assert(sizeof(registro_config_t) <= FLASH_PAGE_SIZE, "Registro deve caber em uma pagina da flash");
+
+// FNV-1a de 32 bits sobre os dados
+static uint32_t calcular_checksum(const configuracao_t *cfg) {
+    const uint8_t *bytes = (const uint8_t *)cfg;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(*cfg); ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool carregar_configuracao(configuracao_t *cfg) {
+    const registro_config_t *registro = (const registro_config_t *)(XIP_BASE + CONFIG_OFFSET);
+
+    if (registro->magica != CONFIG_MAGICA || registro->versao != CONFIG_VERSAO ||
+        registro->tamanho != sizeof(configuracao_t) ||
+        registro->checksum != calcular_checksum(&registro->dados) ||
+        !configuracao_valida(&registro->dados)) {
+        return false;
+    }
+    *cfg = registro->dados;
+    return true;
+}
+
+bool salvar_configuracao(const configuracao_t *cfg) {
+    if (!configuracao_valida(cfg)) {
+        return false;
+    }
+
+    uint8_t pagina[FLASH_PAGE_SIZE];
+    memset(pagina, 0xFF, sizeof(pagina));
+    registro_config_t registro;
+    memset(&registro, 0, sizeof(registro)); // Zera o padding do registro
+    registro.magica = CONFIG_MAGICA;
+    registro.versao = CONFIG_VERSAO;
+    registro.tamanho = sizeof(configuracao_t);
+    registro.dados = *cfg;
+    registro.checksum = calcular_checksum(&registro.dados);
+    memcpy(pagina, &registro, sizeof(registro));
+
+    // A flash não pode ser lida (XIP) durante a gravação
+    uint32_t estado = save_and_disable_interrupts();
+    flash_range_erase(CONFIG_OFFSET, FLASH_SECTOR_SIZE);
+    flash_range_program(CONFIG_OFFSET, pagina, FLASH_PAGE_SIZE);
+    restore_interrupts(estado);
+
+    return memcmp((const void *)(XIP_BASE + CONFIG_OFFSET), pagina, FLASH_PAGE_SIZE) == 0;
+}
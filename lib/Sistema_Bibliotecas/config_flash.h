@@ -0,0 +1,16 @@
+#ifndef CONFIG_FLASH_H
+#define CONFIG_FLASH_H
+
+#include <stdbool.h>
+#include "configuracao.h"
+
+// Persistência da configuração no último setor da flash
+
+// Carrega a configuração gravada; retorna false (e deixa cfg intacta)
+// se o setor estiver vazio, corrompido ou for de outra versão
+bool carregar_configuracao(configuracao_t *cfg);
+// Apaga o setor e grava cfg. Bloqueia por algumas dezenas de ms com as
+// interrupções desligadas: chamar apenas entre medições.
+bool salvar_configuracao(const configuracao_t *cfg);
+
+#endif // CONFIG_FLASH_H
@@ -0,0 +1,34 @@
+#include "configuracao.h"
+#include "perfil_desempenho.h"
+#include "../Medicao_Bibliotecas/codigo_cores.h"
+
+// Pausa entre medições de fábrica de cada perfil
+static const uint32_t INTERVALOS_PADRAO_MS[NUM_PERFIS] = {
+    [PERFIL_RAPIDO]      = 0,
+    [PERFIL_EQUILIBRADO] = 200, // Cadência original
+    [PERFIL_ECONOMICO]   = 500,
+};
+
+uint32_t intervalo_padrao_ms(uint8_t perfil) {
+    return (perfil < NUM_PERFIS) ? INTERVALOS_PADRAO_MS[perfil] : 0;
+}
+
+void configuracao_padrao(configuracao_t *cfg) {
+    cfg->num_amostras = 100;
+    cfg->serie = SERIE_E24;
+    cfg->perfil = PERFIL_INICIAL;
+    cfg->modo_grafico = 0;
+    cfg->resistor_conhecido = 10000.0f; // Resistor conhecido de 10 kΩ
+    cfg->limite_aberto = 450000.0f;
+    cfg->intervalo_ms = intervalo_padrao_ms(PERFIL_INICIAL);
+}
+
+bool configuracao_valida(const configuracao_t *cfg) {
+    return cfg->num_amostras >= AMOSTRAS_MIN && cfg->num_amostras <= AMOSTRAS_MAX &&
+           cfg->serie < NUM_SERIES &&
+           cfg->perfil < NUM_PERFIS &&
+           cfg->modo_grafico <= 1 &&
+           cfg->resistor_conhecido >= RESISTOR_MIN && cfg->resistor_conhecido <= RESISTOR_MAX &&
+           cfg->limite_aberto >= LIMITE_ABERTO_MIN && cfg->limite_aberto <= LIMITE_ABERTO_MAX &&
+           cfg->intervalo_ms <= INTERVALO_MAX_MS;
+}
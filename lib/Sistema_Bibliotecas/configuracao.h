@@ -0,0 +1,40 @@
+#ifndef CONFIGURACAO_H
+#define CONFIGURACAO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "perfil_desempenho.h"
+
+// Limites aceitos pelos comandos "set"
+#define AMOSTRAS_MIN 1
+#define AMOSTRAS_MAX 1000
+#define RESISTOR_MIN 1.0f
+#define RESISTOR_MAX 10000000.0f
+#define LIMITE_ABERTO_MIN 1.0f
+#define LIMITE_ABERTO_MAX 100000000.0f
+#define INTERVALO_MAX_MS 10000
+
+#ifndef PERFIL_INICIAL
+#define PERFIL_INICIAL PERFIL_EQUILIBRADO // Perfil de fábrica (opção PERFIL_INICIAL no CMake)
+#endif
+
+// Parâmetros do motor de medição ajustáveis em execução
+typedef struct {
+    uint16_t num_amostras;     // Leituras do ADC por medição
+    uint8_t serie;             // serie_e_t usada na aproximação
+    uint8_t perfil;            // perfil_t de desempenho
+    uint8_t modo_grafico;      // 0 = numérico, 1 = gráfico de tendência
+    float resistor_conhecido;  // Resistor de referência do divisor (ohms)
+    float limite_aberto;       // Acima disso: "Nenhum resistor encontrado" (ohms)
+    uint32_t intervalo_ms;     // Pausa entre medições
+} configuracao_t;
+
+// Valores de fábrica: PERFIL_INICIAL com a cadência dele; usados no boot sem
+// configuração gravada e pelo comando "padrao"
+void configuracao_padrao(configuracao_t *cfg);
+// Cadência de fábrica de um perfil (pausa entre medições); 0 se inválido
+uint32_t intervalo_padrao_ms(uint8_t perfil);
+// Confere todos os campos contra os limites acima
+bool configuracao_valida(const configuracao_t *cfg);
+
+#endif // CONFIGURACAO_H
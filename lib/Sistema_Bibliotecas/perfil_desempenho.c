@@ -0,0 +1,44 @@
+#include "perfil_desempenho.h"
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/uart.h"
+#include "hardware/vreg.h"
+
+// Tabela de perfis; a taxa do ADC sai do clk_adc (48 MHz), independente do clk_sys
+static const perfil_config_t PERFIS[NUM_PERFIS] = {
+    [PERFIL_RAPIDO]      = {"Rapido",      200000, VREG_VOLTAGE_1_15,     0.0f},    // 500 kS/s
+    [PERFIL_EQUILIBRADO] = {"Equilibrado", 125000, VREG_VOLTAGE_DEFAULT, 4799.0f},  // 10 kS/s
+    [PERFIL_ECONOMICO]   = {"Economico",    48000, VREG_VOLTAGE_DEFAULT, 23999.0f}, // 2 kS/s
+};
+
+const perfil_config_t *obter_perfil(perfil_t perfil) {
+    return (perfil < NUM_PERFIS) ? &PERFIS[perfil] : NULL;
+}
+
+bool configurar_clock_perfil(perfil_t perfil) {
+    const perfil_config_t *cfg = obter_perfil(perfil);
+    if (cfg == NULL) {
+        return false;
+    }
+
+    // Ao subir o clock, eleva a tensão antes; ao descer, reduz depois
+    bool subindo = cfg->clk_sys_khz * 1000u > clock_get_hz(clk_sys);
+    if (subindo) {
+        vreg_set_voltage(cfg->tensao_vreg);
+        sleep_us(10); // Aguarda a tensão estabilizar
+    }
+
+    if (!set_sys_clock_khz(cfg->clk_sys_khz, false)) {
+        return false; // Frequência não alcançável pelo PLL; mantém a atual
+    }
+
+    if (!subindo) {
+        vreg_set_voltage(cfg->tensao_vreg);
+    }
+
+    // clk_peri acompanha clk_sys: recalcula o baud da UART do stdio
+#ifdef uart_default
+    uart_set_baudrate(uart_default, PICO_DEFAULT_UART_BAUD_RATE);
+#endif
+    return true;
+}
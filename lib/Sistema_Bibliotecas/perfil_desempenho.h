@@ -0,0 +1,30 @@
+#ifndef PERFIL_DESEMPENHO_H
+#define PERFIL_DESEMPENHO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Perfis de desempenho: trocam consumo por medições por segundo
+typedef enum {
+    PERFIL_RAPIDO = 0,   // clk_sys alto, ADC na taxa máxima, sem pausa entre medições
+    PERFIL_EQUILIBRADO,  // Clock padrão e cadência original (200 ms)
+    PERFIL_ECONOMICO,    // clk_sys reduzido, ADC lento e pausa longa
+    NUM_PERFIS
+} perfil_t;
+
+typedef struct {
+    const char *nome;
+    uint32_t clk_sys_khz;   // Frequência do clock do sistema
+    uint8_t tensao_vreg;    // Tensão do núcleo (enum vreg_voltage do SDK)
+    float adc_clkdiv;       // Divisor do ADC: taxa = 48 MHz / (1 + div), máx. 500 kS/s
+} perfil_config_t;
+
+// Configuração de um perfil (NULL se inválido)
+const perfil_config_t *obter_perfil(perfil_t perfil);
+
+// Ajusta tensão do núcleo, clk_sys e o baud da UART do stdio para o perfil.
+// Os demais periféricos que dependem de clk_sys (I2C, PIO) devem ser
+// reconfigurados pelo chamador em seguida.
+bool configurar_clock_perfil(perfil_t perfil);
+
+#endif // PERFIL_DESEMPENHO_H
@@ -1,129 +1,263 @@
 #include <stdio.h>
 #include <math.h>
-#include <float.h>
 #include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
 #include "hardware/i2c.h"
+#include "hardware/clocks.h"
 #include "lib/Display_Bibliotecas/ssd1306.h"
 #include "lib/Display_Bibliotecas/font.h"
+#include "lib/Display_Bibliotecas/grafico_tendencia.h"
 #include "lib/Matriz_Bibliotecas/matriz_led.h"
+#include "lib/Medicao_Bibliotecas/codigo_cores.h"
+#include "lib/Medicao_Bibliotecas/estatistica.h"
+#include "lib/Sistema_Bibliotecas/perfil_desempenho.h"
+#include "lib/Sistema_Bibliotecas/configuracao.h"
+#include "lib/Sistema_Bibliotecas/comandos.h"
+#include "lib/Sistema_Bibliotecas/config_flash.h"
 
 // Definições de hardware
 #define I2C_PORT i2c1
 #define I2C_SDA_PIN 14
 #define I2C_SCL_PIN 15
+#define I2C_BAUD 400000 // Fast mode do SSD1306, mantido em todos os perfis
 #define OLED_ADDR 0x3C
 #define ADC_PIN 28
-#define RESISTOR_CONHECIDO 10000.0f // Resistor conhecido de 10 kΩ
 #define RESOLUCAO_ADC 4095.0f  // Resolução do ADC (12-bit)
 
 // Constantes da Interface OLED
+#ifdef SSD1306_FIXED
+#define LARGURA_OLED SSD1306_WIDTH  // Geometria fixada pelo preset do CMake
+#define ALTURA_OLED SSD1306_HEIGHT
+#else
 #define LARGURA_OLED 128
 #define ALTURA_OLED 64
+#endif
 #define LARGURA_FONTE 8
 #define ALTURA_FONTE 8
 #define ESPACAMENTO 2
 #define ESPACO_LINHA ALTURA_FONTE
 #define SIMBOLO_OHM 127 // Caractere usado para representar Ω (Ohm)
 #define POSICAO_VALOR_X 80
-
-// Série E24 de valores de resistores
-static const float VALORES_E24[24] = {
-    10, 11, 12, 13, 15, 16, 18, 20,
-    22, 24, 27, 30, 33, 36, 39, 43,
-    47, 51, 56, 62, 68, 75, 82, 91
-};
-
-// Nomes das cores das faixas dos resistores
-static const char *NOMES_CORES[12] = {
-    "Prata", "Ouro", "Preto", "Marrom",
-    "Vermelho", "Laranja", "Amarelo",
-    "Verde", "Azul", "Violeta", "Cinza","Branco"
-};
+#define PAGINA_GRAFICO 2 // Modo gráfico: páginas 0-1 com texto, demais com o gráfico
+#if ALTURA_OLED >= 64
+#define TELA_COMPLETA 1 // 8 linhas de texto; com 32 linhas só cabem 4 (layout compacto)
+#endif
+
+#define INTERVALO_LOG_PERFIL_US 2000000 // Período do log de taxa e latência
+#define PASSO_ESPERA_US 1000 // Consulta da serial durante a pausa entre medições
+
+// Estado do perfil ativo e estatísticas da janela de log
+static perfil_t perfil_atual = PERFIL_INICIAL;
+static uint32_t medicoes_janela = 0;
+static uint64_t latencia_total_us = 0;
+static uint32_t latencia_max_us = 0;
+static uint64_t inicio_janela_us = 0;
+
+// Configuração ativa (lida pela medição) e pendente (editada pelos comandos).
+// A pendente só vira ativa em aplicar_configuracao, entre duas medições.
+static configuracao_t config;
+static configuracao_t config_pendente;
+static bool config_alterada = false;
+static bool salvar_pendente = false;
+static leitor_linha_t leitor_serial;
+
+// Texto já enviado em cada página fixa do modo gráfico ("" = reenviar)
+static char texto_leitura[25];
+static char texto_eixo[25];
 
 // Inicializa o hardware (I2C, ADC, Matriz LED)
 void inicializar_hardware() {
     stdio_init_all(); // Inicializa a comunicação serial
-    i2c_init(I2C_PORT, 400000); // Inicializa o I2C
+    i2c_init(I2C_PORT, I2C_BAUD); // Inicializa o I2C
     gpio_set_function(I2C_SDA_PIN, GPIO_FUNC_I2C); // Configura o pino SDA
     gpio_set_function(I2C_SCL_PIN, GPIO_FUNC_I2C); // Configura o pino SCL
     gpio_pull_up(I2C_SDA_PIN); // Habilita o pull-up no pino SDA
     gpio_pull_up(I2C_SCL_PIN); // Habilita o pull-up no pino SCL
     adc_init(); // Inicializa o ADC
     adc_gpio_init(ADC_PIN); // Configura o pino do ADC
+    adc_fifo_setup(true, false, 1, false, false); // FIFO para amostragem cadenciada pelo clkdiv
     inicializar_matriz_led(); // Inicializa a matriz LED
 }
 
-// Lê o valor do ADC e retorna a média de 100 leituras
-float ler_adc() {
-    adc_select_input(2); // Seleciona o canal ADC
-    float soma = 0;
-    for (int i = 0; i < 100; ++i) {
-        soma += adc_read(); // Lê o valor do ADC
-        sleep_us(100); // Espera 100 microsegundos
+// Aplica um perfil de desempenho e reajusta os periféricos que dependem de clk_sys
+bool aplicar_perfil(perfil_t perfil) {
+    const perfil_config_t *cfg = obter_perfil(perfil);
+    if (cfg == NULL || !configurar_clock_perfil(perfil)) {
+        printf("Perfil: falha ao aplicar perfil %d\n", perfil);
+        return false;
     }
-    return soma / 100.0f; // Retorna a média das leituras
+    i2c_set_baudrate(I2C_PORT, I2C_BAUD); // Divisor do I2C depende de clk_peri
+    atualizar_clock_matriz();             // Divisor da PIO depende de clk_sys
+    adc_set_clkdiv(cfg->adc_clkdiv);      // Taxa de amostragem do ADC
+
+    perfil_atual = perfil;
+    medicoes_janela = 0;
+    latencia_total_us = 0;
+    latencia_max_us = 0;
+    inicio_janela_us = time_us_64();
+    printf("Perfil: %s (clk_sys %lu kHz, ADC %.0f S/s, pausa sugerida %lu ms)\n", cfg->nome,
+           (unsigned long)(clock_get_hz(clk_sys) / 1000), 48000000.0f / (1.0f + cfg->adc_clkdiv),
+           (unsigned long)intervalo_padrao_ms(perfil));
+    return true;
 }
 
-// Calcula a resistência com base no valor do ADC
-float calcular_resistencia(float valor_adc) {
-    if (valor_adc >= RESOLUCAO_ADC - 1) {
-        return INFINITY; // Se o valor do ADC estiver no máximo, retorna infinito
+// Consome os caracteres disponíveis na serial sem bloquear e executa as linhas completas
+void processar_comandos_serial() {
+    char resposta[160];
+    for (int i = 0; i < TAM_LINHA_COMANDO; ++i) { // Limita o trabalho por iteração
+        int c = getchar_timeout_us(0);
+        if (c == PICO_ERROR_TIMEOUT) {
+            break;
+        }
+        if (!leitor_adicionar(&leitor_serial, c)) {
+            continue;
+        }
+        resultado_comando_t resultado = executar_comando(leitor_serial.linha, &config_pendente, resposta, sizeof(resposta));
+        printf("%s\n", resposta);
+        if (resultado == COMANDO_ALTERADO) {
+            config_alterada = true;
+        } else if (resultado == COMANDO_SALVAR) {
+            config_alterada = true;
+            salvar_pendente = true;
+        }
+    }
+}
+
+// Pausa até o prazo da próxima medição sem deixar de atender a serial.
+// Volta antes do prazo se um comando alterou a configuração, que então é
+// aplicada logo antes da próxima medição.
+void aguardar_proxima_medicao(uint64_t prazo_us) {
+    while (true) {
+        processar_comandos_serial();
+        uint64_t agora = time_us_64();
+        if (config_alterada || agora >= prazo_us) {
+            return;
+        }
+        uint64_t restante = prazo_us - agora;
+        sleep_us(restante < PASSO_ESPERA_US ? restante : PASSO_ESPERA_US);
     }
-    return (RESISTOR_CONHECIDO * valor_adc) / (RESOLUCAO_ADC - valor_adc); // Calcula a resistência
 }
 
-// Aproxima a resistência medida ao valor mais próximo da série E24
-bool aproximar_e24(float resistencia, float *melhor_valor, int *melhor_exp, int *melhor_idx) {
-    float melhor_diferenca = FLT_MAX;
-    bool encontrado = false;
-
-    if (isfinite(resistencia) && resistencia > 0) {
-        for (int e = 0; e <= 6; ++e) { // Expoentes de 0 a 6 (Ohm a MOhm)
-            for (int i = 0; i < 24; ++i) { // Valores da série E24
-                float candidato = VALORES_E24[i] * powf(10, e);
-                float diferenca = fabsf(logf(candidato) - logf(resistencia)); // Comparação logarítmica
-                if (diferenca < melhor_diferenca) {
-                    melhor_diferenca = diferenca;
-                    *melhor_valor = candidato;
-                    *melhor_exp = e;
-                    *melhor_idx = i;
-                    encontrado = true;
-                }
+// Força o reenvio do gráfico e das páginas fixas na próxima leitura
+void invalidar_grafico_oled(grafico_tendencia_t *grafico) {
+    grafico_invalidar(grafico);
+    texto_leitura[0] = '\0';
+    texto_eixo[0] = '\0';
+}
+
+// Troca a configuração ativa pela pendente de uma só vez e aplica os efeitos colaterais
+void aplicar_configuracao(ssd1306_t *oled, grafico_tendencia_t *grafico) {
+    if (!config_alterada) {
+        return;
+    }
+    configuracao_t anterior = config;
+    config = config_pendente;
+    config_alterada = false;
+
+    if (config.perfil != anterior.perfil) {
+        if (aplicar_perfil((perfil_t)config.perfil)) {
+            // Sem intervalo explícito no mesmo lote, adota a cadência do perfil
+            if (config.intervalo_ms == anterior.intervalo_ms) {
+                config.intervalo_ms = intervalo_padrao_ms(config.perfil);
             }
+        } else {
+            config.perfil = anterior.perfil;
         }
+        config_pendente = config;
+    }
+
+    if (config.modo_grafico && !anterior.modo_grafico) {
+        grafico_iniciar(grafico, oled, PAGINA_GRAFICO); // Recomeça o histórico
+        invalidar_grafico_oled(grafico);
+    }
+
+    if (salvar_pendente) {
+        salvar_pendente = false;
+        printf(salvar_configuracao(&config) ? "ok gravado na flash\n" : "erro: falha ao gravar na flash\n");
+    }
+}
+
+// Contabiliza uma medição e imprime taxa e latência do perfil periodicamente
+void registrar_medicao(uint64_t inicio_us) {
+    uint64_t agora = time_us_64();
+    uint32_t latencia = (uint32_t)(agora - inicio_us);
+    medicoes_janela++;
+    latencia_total_us += latencia;
+    if (latencia > latencia_max_us) {
+        latencia_max_us = latencia;
+    }
+
+    uint64_t janela = agora - inicio_janela_us;
+    if (janela >= INTERVALO_LOG_PERFIL_US) {
+        printf("Perfil %s: %.1f med/s, latencia media %lu us, max %lu us\n",
+               obter_perfil(perfil_atual)->nome, medicoes_janela * 1e6f / janela,
+               (unsigned long)(latencia_total_us / medicoes_janela), (unsigned long)latencia_max_us);
+        medicoes_janela = 0;
+        latencia_total_us = 0;
+        latencia_max_us = 0;
+        inicio_janela_us = agora;
     }
+}
 
-    if (!encontrado) {
-        *melhor_valor = 0;
-        *melhor_exp = -1;
-        *melhor_idx = -1;
+// Lê o ADC e retorna a média das leituras, acumulando a estatística do bloco.
+// As amostras vêm da FIFO no ritmo do clkdiv do perfil ativo.
+float ler_adc(estatistica_t *est) {
+    adc_select_input(2); // Seleciona o canal ADC
+    estatistica_iniciar(est);
+    adc_fifo_drain(); // Descarta sobras da leitura anterior
+    adc_run(true);
+    for (int i = 0; i < config.num_amostras; ++i) {
+        estatistica_adicionar(est, adc_fifo_get_blocking()); // Lê o valor do ADC
     }
-    return encontrado;
+    adc_run(false);
+    adc_fifo_drain();
+    return est->media; // Retorna a média das leituras
 }
 
-// Determina as cores das faixas do resistor
-void determinar_cores(int idx_e24_base, int expoente, const char **cores) {
-    int base = (int)VALORES_E24[idx_e24_base]; // Obtém o valor base da série E24
-    int d1 = base / 10; // Primeiro dígito
-    int d2 = base % 10; // Segundo dígito
+// Calcula a resistência com base no valor do ADC
+float calcular_resistencia(float valor_adc) {
+    if (valor_adc >= RESOLUCAO_ADC - 1) {
+        return INFINITY; // Se o valor do ADC estiver no máximo, retorna infinito
+    }
+    return (config.resistor_conhecido * valor_adc) / (RESOLUCAO_ADC - valor_adc); // Calcula a resistência
+}
 
-    // Determina a cor da primeira faixa
-    cores[0] = (d1 >= 0 && d1 <= 9) ? NOMES_CORES[d1 + 2] : "---";
-    //De 0 até 9 faixas de cores definidas acima
-    // Determina a cor da segunda faixa
-    cores[1] = (d2 >= 0 && d2 <= 9) ? NOMES_CORES[d2 + 2] : "---";
+// Incerteza padrão da resistência: ruído da média do bloco somado à
+// quantização do ADC (1/sqrt(12) LSB), propagados por dR/dADC
+float calcular_incerteza(const estatistica_t *est, float valor_adc) {
+    if (valor_adc >= RESOLUCAO_ADC - 1) {
+        return INFINITY;
+    }
+    float u_media = estatistica_incerteza_media(est);
+    float u_adc = sqrtf(u_media * u_media + 1.0f / 12.0f);
+    float denominador = RESOLUCAO_ADC - valor_adc;
+    float sensibilidade = (config.resistor_conhecido * RESOLUCAO_ADC) / (denominador * denominador);
+    return sensibilidade * u_adc;
+}
 
-    // Determina a cor da terceira faixa (multiplicador)
-    cores[2] = (expoente >= 0 && expoente <= 7) ? NOMES_CORES[expoente + 2] : "---";
+// Formata um valor em ohms para o display
+static void formatar_ohms(char *buffer, size_t tamanho, float valor) {
+    if (isinf(valor)) {
+        strcpy(buffer, "Aberto");
+    } else if (valor < 1.0f && valor > 0.0f) {
+        snprintf(buffer, tamanho, "%.2f %c", valor, SIMBOLO_OHM);
+    } else if (valor == 0.0f) {
+        snprintf(buffer, tamanho, "0 %c", SIMBOLO_OHM);
+    } else {
+        snprintf(buffer, tamanho, "%.0f %c", valor, SIMBOLO_OHM);
+    }
 }
 
 // Atualiza o display OLED com os valores lidos e calculados
-void atualizar_display_oled(ssd1306_t *oled, float valor_adc, float resistencia, float melhor_valor_e24, const char **cores) {
+void atualizar_display_oled(ssd1306_t *oled, float valor_adc, float resistencia, float incerteza, const codigo_resistor_t *codigo) {
+#ifdef MEDIR_TEMPO_FRAME
+    uint64_t t_inicio = time_us_64();
+#endif
     ssd1306_fill(oled, false); // Limpa o display
 
     char buffer[25]; // Buffer para strings formatadas
+#ifdef TELA_COMPLETA
     uint8_t y = ESPACAMENTO; // Posição Y inicial
 
     // Linha 1: Valor ADC
@@ -133,96 +267,171 @@ void atualizar_display_oled(ssd1306_t *oled, float valor_adc, float resistencia,
     y += ESPACO_LINHA;
 
     // Linha 2: Resistor Conhecido
-    snprintf(buffer, sizeof(buffer), "%.0f", RESISTOR_CONHECIDO);
+    snprintf(buffer, sizeof(buffer), "%.0f", config.resistor_conhecido);
     ssd1306_draw_string(oled, "R Fixo:", ESPACAMENTO, y, false);
     ssd1306_draw_string(oled, buffer, POSICAO_VALOR_X, y, false);
     y += ESPACO_LINHA;
+#else
+    uint8_t y = 0; // Layout compacto: R medido, R da série e as faixas
+#endif
 
     // Linha 3: Resistência Medida
     ssd1306_draw_string(oled, "R Medido:", ESPACAMENTO, y, false);
-    if (isinf(resistencia)) {
-        strcpy(buffer, "Aberto");
-    } else if (resistencia < 1.0f && resistencia > 0.0f) {
-        snprintf(buffer, sizeof(buffer), "%.2f %c", resistencia, SIMBOLO_OHM);
-    } else if (resistencia == 0.0f) {
-        snprintf(buffer, sizeof(buffer), "0 %c", SIMBOLO_OHM);
-    } else {
-        snprintf(buffer, sizeof(buffer), "%.0f %c", resistencia, SIMBOLO_OHM);
-    }
+    formatar_ohms(buffer, sizeof(buffer), resistencia);
     ssd1306_draw_string(oled, buffer, POSICAO_VALOR_X, y, false);
     y += ESPACO_LINHA;
 
-    // Linha 4: Resistência Comercial E24
-    ssd1306_draw_string(oled, "R E24:", ESPACAMENTO, y, false);
-    if (melhor_valor_e24 > 0) {
-        snprintf(buffer, sizeof(buffer), "%.0f %c", melhor_valor_e24, SIMBOLO_OHM);
+#ifdef TELA_COMPLETA
+    // Linha 4: Incerteza padrão da medida
+    ssd1306_draw_string(oled, "Incert:", ESPACAMENTO, y, false);
+    formatar_ohms(buffer, sizeof(buffer), incerteza);
+    ssd1306_draw_string(oled, buffer, POSICAO_VALOR_X, y, false);
+    y += ESPACO_LINHA;
+#else
+    (void)valor_adc;
+    (void)incerteza;
+#endif
+
+    // Linha 5: Resistência Comercial da série
+    snprintf(buffer, sizeof(buffer), "R %s:", nome_serie((serie_e_t)config.serie));
+    ssd1306_draw_string(oled, buffer, ESPACAMENTO, y, false);
+    if (codigo->num_faixas > 0) {
+        formatar_ohms(buffer, sizeof(buffer), codigo->valor);
     } else {
         strcpy(buffer, "---");
     }
     ssd1306_draw_string(oled, buffer, POSICAO_VALOR_X, y, false);
     y += ESPACO_LINHA;
 
+#ifdef TELA_COMPLETA
     // Separador Horizontal
-    if (y > ALTURA_OLED - 3 - (3 * ALTURA_FONTE)) {
-        y = ALTURA_OLED - 3 - (3 * ALTURA_FONTE);
+    if (y > ALTURA_OLED - 3 - (2 * ALTURA_FONTE)) {
+        y = ALTURA_OLED - 3 - (2 * ALTURA_FONTE);
     }
     ssd1306_hline(oled, ESPACAMENTO, LARGURA_OLED - 1 - ESPACAMENTO, y, true);
     y += 3;
+#endif
+
+    // Faixas de cor abreviadas: dígitos em uma linha, multiplicador e tolerância na outra
+    uint8_t num_digitos = (codigo->num_faixas > 2) ? codigo->num_faixas - 2 : 0;
+    uint8_t x = ESPACAMENTO;
+    ssd1306_draw_string(oled, "D:", x, y, false);
+    x += 3 * LARGURA_FONTE;
+    for (uint8_t i = 0; i < num_digitos; ++i) {
+        ssd1306_draw_string(oled, abreviacao_cor(codigo->faixas[i]), x, y, false);
+        x += 4 * LARGURA_FONTE;
+    }
+    y += ESPACO_LINHA;
 
-    // Exibir Faixas de Cor
-    const char *rotulos[3] = {"1a:", "2a:", "3a:"};
-    int posicao_nome_cor = ESPACAMENTO + (strlen(rotulos[0]) * LARGURA_FONTE) + 2;
-
-    for (int i = 0; i < 3 && (y + ALTURA_FONTE) <= ALTURA_OLED; ++i) {
-        ssd1306_draw_string(oled, rotulos[i], ESPACAMENTO, y, false);
-        ssd1306_draw_string(oled, cores[i], posicao_nome_cor, y, false);
-        y += ESPACO_LINHA;
+    if ((y + ALTURA_FONTE) <= ALTURA_OLED) {
+        ssd1306_draw_string(oled, "M:", ESPACAMENTO, y, false);
+        ssd1306_draw_string(oled, "T:", ESPACAMENTO + 7 * LARGURA_FONTE, y, false);
+        if (codigo->num_faixas > 0) {
+            ssd1306_draw_string(oled, abreviacao_cor(codigo->faixas[num_digitos]), ESPACAMENTO + 3 * LARGURA_FONTE, y, false);
+            ssd1306_draw_string(oled, abreviacao_cor(codigo->faixas[num_digitos + 1]), ESPACAMENTO + 10 * LARGURA_FONTE, y, false);
+        }
     }
 
+#ifdef MEDIR_TEMPO_FRAME
+    uint64_t t_render = time_us_64();
+#endif
     ssd1306_send_data(oled); // Envia os dados para o display OLED
+#ifdef MEDIR_TEMPO_FRAME
+    uint64_t t_fim = time_us_64();
+    printf("Frame: render %llu us, envio %llu us\n",
+           (unsigned long long)(t_render - t_inicio), (unsigned long long)(t_fim - t_render));
+#endif
+}
+
+// Redesenha e envia uma página fixa do modo gráfico só se o texto mudou
+static void atualizar_linha_grafico(ssd1306_t *oled, uint8_t pagina, const char *rotulo, const char *valor, char *enviado) {
+    if (strcmp(valor, enviado) == 0) {
+        return;
+    }
+    strcpy(enviado, valor);
+    ssd1306_rect(oled, pagina * 8, 0, LARGURA_OLED, 8, false, true); // Limpa a página
+    ssd1306_draw_string(oled, rotulo, ESPACAMENTO, pagina * 8, false);
+    ssd1306_draw_string(oled, valor, ESPACAMENTO + (strlen(rotulo) + 1) * LARGURA_FONTE, pagina * 8, false);
+    ssd1306_send_area(oled, 0, LARGURA_OLED - 1, pagina, pagina);
+}
+
+// Modo gráfico: leitura e eixo nas páginas fixas, tendência em varredura abaixo
+void atualizar_grafico_oled(ssd1306_t *oled, grafico_tendencia_t *grafico, float resistencia) {
+    grafico_adicionar(grafico, resistencia); // Envia só a coluna nova (ou a faixa, se mudar a escala)
+
+    char buffer[25];
+    formatar_ohms(buffer, sizeof(buffer), resistencia);
+    atualizar_linha_grafico(oled, 0, "R:", buffer, texto_leitura);
+
+    // Valor do eixo central (a escala é +-5% em torno dele, no mínimo +-0,5 ohm)
+    formatar_ohms(buffer, sizeof(buffer), grafico->centro);
+    atualizar_linha_grafico(oled, 1, "Eixo:", buffer, texto_eixo);
 }
 
 int main(void) {
     inicializar_hardware(); // Inicializa o hardware
 
+    // Configuração gravada na flash ou, na falta dela, valores de fábrica
+    configuracao_padrao(&config);
+    printf(carregar_configuracao(&config) ? "Config: carregada da flash\n" : "Config: valores de fabrica\n");
+    if (!aplicar_perfil((perfil_t)config.perfil)) { // Clock, I2C, PIO e ADC do perfil de boot
+        config.perfil = perfil_atual;
+    }
+    config_pendente = config;
+    leitor_iniciar(&leitor_serial);
+    printf("Comandos: help | get [param] | set <param> <valor> | save | padrao\n");
+
     ssd1306_t oled;
     ssd1306_init(&oled, LARGURA_OLED, ALTURA_OLED, false, OLED_ADDR, I2C_PORT);
     ssd1306_config(&oled);
 
+    grafico_tendencia_t grafico;
+    grafico_iniciar(&grafico, &oled, PAGINA_GRAFICO);
+
     while (true) {
-        float valor_adc = ler_adc(); // Lê o valor do ADC
+        processar_comandos_serial(); // Comandos da serial, sem bloquear
+        aplicar_configuracao(&oled, &grafico); // Novos parâmetros só entre medições
+        uint64_t inicio_medicao = time_us_64();
+
+        estatistica_t est;
+        float valor_adc = ler_adc(&est); // Lê o valor do ADC
         float resistencia = calcular_resistencia(valor_adc); // Calcula a resistência
 
-        // Verifica se a resistência é maior que 450kΩ
-        if (resistencia > 450000.0f) {
+        // Verifica se a resistência é maior que o limite de circuito aberto (450kΩ de fábrica)
+        if (resistencia > config.limite_aberto) {
             desligar_matriz(); // Desliga a matriz LED
+            if (config.modo_grafico) {
+                invalidar_grafico_oled(&grafico); // Tela cheia: redesenha o gráfico na próxima leitura
+            }
              
             ssd1306_fill(&oled, false); //limpa display
-            ssd1306_draw_string(&oled, "Nenhum resistor", 7, 20, false);
-            ssd1306_draw_string(&oled, "encontrado", 20, 30, false);
+            ssd1306_draw_string(&oled, "Nenhum resistor", 7, ALTURA_OLED / 2 - 12, false);
+            ssd1306_draw_string(&oled, "encontrado", 20, ALTURA_OLED / 2 - 2, false);
             ssd1306_send_data(&oled);
+            registrar_medicao(inicio_medicao);
             
             continue; 
         }
 
-        float melhor_valor_e24 = 0;
-        int melhor_exp = -1, melhor_idx = -1;
-        bool e24_encontrado = aproximar_e24(resistencia, &melhor_valor_e24, &melhor_exp, &melhor_idx); // Aproxima ao valor E24
+        float incerteza = calcular_incerteza(&est, valor_adc); // Incerteza padrão da resistência
 
-        const char *cores[3] = {"---", "---", "---"};
-        if (e24_encontrado) {
-            determinar_cores(melhor_idx, melhor_exp, cores); // Determina as cores das faixas
-        }
+        codigo_resistor_t codigo;
+        bool codificado = codificar_resistor(resistencia, (serie_e_t)config.serie, &codigo); // Valor da série e faixas
 
-        atualizar_display_oled(&oled, valor_adc, resistencia, melhor_valor_e24, cores); // Atualiza o display OLED
+        if (config.modo_grafico) {
+            atualizar_grafico_oled(&oled, &grafico, resistencia); // Tendência em varredura
+        } else {
+            atualizar_display_oled(&oled, valor_adc, resistencia, incerteza, &codigo); // Atualiza o display OLED
+        }
 
-        if (e24_encontrado) {
-            mostrar_faixas_cores(cores[0], cores[1], cores[2]); // Mostra as faixas de cores na matriz LED
+        if (codificado) {
+            mostrar_codigo_cores(codigo.faixas, codigo.num_faixas); // Uma faixa por linha da matriz LED
         } else {
-            desligar_matriz(); // Desliga a matriz LED se nenhum resistor E24 for encontrado
+            desligar_matriz(); // Desliga a matriz LED se o valor não for codificável
         }
 
-        sleep_ms(200); // Pausa de 200 ms
+        registrar_medicao(inicio_medicao);
+        aguardar_proxima_medicao(time_us_64() + config.intervalo_ms * 1000ull); // Cadência configurada, atendendo a serial
     }
 
     return 0;
@@ -0,0 +1,14 @@
+#ifndef STUB_HARDWARE_I2C_H
+#define STUB_HARDWARE_I2C_H
+
+// Substituto do hardware/i2c.h do SDK para os testes no host: o próprio
+// teste implementa i2c_write_blocking com um modelo do controlador
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct i2c_inst i2c_inst_t;
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+#endif // STUB_HARDWARE_I2C_H
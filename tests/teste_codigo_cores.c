@@ -0,0 +1,151 @@
+// Teste no host do codificador de código de cores: percorre todos os valores
+// das séries E24/E96/E192 em todas as décadas codificáveis e os pontos médios
+// logarítmicos entre vizinhos.
+#include <math.h>
+#include <stdint.h>
+#include "codigo_cores.h"
+#include "teste.h"
+
+#define MULT_MIN (-2)
+#define MULT_MAX 9
+
+// Referência independente da tabela do codificador: a E24 é tabelada (não
+// segue a fórmula), a E96 é round(100 * 10^(i/96)) e a E192 idem com a única
+// exceção padronizada (919 -> 920)
+static const uint16_t REF_E24[24] = {
+    10, 11, 12, 13, 15, 16, 18, 20, 22, 24, 27, 30,
+    33, 36, 39, 43, 47, 51, 56, 62, 68, 75, 82, 91
+};
+
+static int quantidade_serie(serie_e_t serie) {
+    return serie == SERIE_E24 ? 24 : (serie == SERIE_E96 ? 96 : 192);
+}
+
+static int digitos_serie(serie_e_t serie) {
+    return serie == SERIE_E24 ? 2 : 3;
+}
+
+static uint8_t tolerancia_serie(serie_e_t serie) {
+    return serie == SERIE_E24 ? COR_OURO : (serie == SERIE_E96 ? COR_MARROM : COR_VERDE);
+}
+
+// Mantissa inteira do i-ésimo valor da série (i pode passar da década)
+static int valor_referencia(serie_e_t serie, int i, int *mult) {
+    int n = quantidade_serie(serie);
+    while (i >= n) {
+        i -= n;
+        (*mult)++;
+    }
+    if (serie == SERIE_E24) {
+        return REF_E24[i];
+    }
+    int v = (int)lround(100.0 * pow(10.0, (double)i / n));
+    if (v == 919) {
+        v = 920;
+    }
+    return v;
+}
+
+// Valor em ohms de mantissa * 10^mult (mult é o multiplicador da faixa)
+static double em_ohms(int mantissa, int mult) {
+    return mantissa * pow(10.0, mult);
+}
+
+static void verificar_codigo(serie_e_t serie, float entrada, int mantissa, int mult) {
+    codigo_resistor_t c;
+    bool ok = codificar_resistor(entrada, serie, &c);
+    VERIFICAR(ok, "%s: %g nao codificado (esperado %d e%d)",
+              nome_serie(serie), entrada, mantissa, mult);
+    if (!ok) {
+        return;
+    }
+
+    double esperado = em_ohms(mantissa, mult);
+    VERIFICAR(fabs(c.valor - esperado) <= esperado * 1e-6,
+              "%s: %g -> %g, esperado %g", nome_serie(serie), entrada, c.valor, esperado);
+
+    int digitos = digitos_serie(serie);
+    VERIFICAR(c.num_faixas == digitos + 2, "%s: %g com %d faixas",
+              nome_serie(serie), entrada, c.num_faixas);
+
+    // Dígitos significativos
+    int d = mantissa;
+    for (int k = digitos - 1; k >= 0; --k) {
+        VERIFICAR(c.faixas[k] == d % 10, "%s: %g faixa %d = %d, esperado %d",
+                  nome_serie(serie), entrada, k, c.faixas[k], d % 10);
+        d /= 10;
+    }
+
+    // Multiplicador e tolerância
+    uint8_t mult_cor = mult == -2 ? COR_PRATA : (mult == -1 ? COR_OURO : (uint8_t)mult);
+    VERIFICAR(c.faixas[digitos] == mult_cor, "%s: %g multiplicador %s, esperado %s",
+              nome_serie(serie), entrada, nome_cor(c.faixas[digitos]), nome_cor(mult_cor));
+    VERIFICAR(c.faixas[digitos + 1] == tolerancia_serie(serie), "%s: %g tolerancia %s",
+              nome_serie(serie), entrada, nome_cor(c.faixas[digitos + 1]));
+}
+
+static void verificar_rejeitado(serie_e_t serie, float entrada) {
+    codigo_resistor_t c;
+    bool ok = codificar_resistor(entrada, serie, &c);
+    VERIFICAR(!ok && c.num_faixas == 0, "%s: %g deveria ser rejeitado",
+              nome_serie(serie), entrada);
+}
+
+// Todos os valores em todas as décadas, e os dois lados de cada ponto médio
+// logarítmico até o vizinho seguinte
+static void testar_serie(serie_e_t serie) {
+    int n = quantidade_serie(serie);
+
+    for (int mult = MULT_MIN; mult <= MULT_MAX; ++mult) {
+        for (int i = 0; i < n; ++i) {
+            int m = mult;
+            int atual = valor_referencia(serie, i, &m);
+            int m_prox = mult;
+            int proximo = valor_referencia(serie, i + 1, &m_prox);
+
+            double v = em_ohms(atual, mult);
+            verificar_codigo(serie, (float)v, atual, mult);
+            verificar_codigo(serie, (float)(v * 1.0005), atual, mult);
+            verificar_codigo(serie, (float)(v * 0.9995), atual, mult);
+
+            double meio = sqrt(v * em_ohms(proximo, m_prox));
+            verificar_codigo(serie, (float)(meio * (1.0 - 1e-4)), atual, mult);
+            if (m_prox <= MULT_MAX) {
+                verificar_codigo(serie, (float)(meio * (1.0 + 1e-4)), proximo, m_prox);
+            } else {
+                verificar_rejeitado(serie, (float)(meio * (1.0 + 1e-4)));
+            }
+        }
+    }
+
+    // Abaixo do primeiro valor: metade de cima do ponto médio ainda arredonda
+    // para ele, a de baixo sai da faixa
+    int base = digitos_serie(serie) == 2 ? 10 : 100;
+    int m_ult = MULT_MIN - 1;
+    int ultimo = valor_referencia(serie, n - 1, &m_ult);
+    double primeiro = em_ohms(base, MULT_MIN);
+    double meio = sqrt(primeiro * em_ohms(ultimo, m_ult));
+    verificar_codigo(serie, (float)(meio * (1.0 + 1e-4)), base, MULT_MIN);
+    verificar_rejeitado(serie, (float)(meio * (1.0 - 1e-4)));
+
+    // Entradas inválidas
+    verificar_rejeitado(serie, 0.0f);
+    verificar_rejeitado(serie, -100.0f);
+    verificar_rejeitado(serie, INFINITY);
+    verificar_rejeitado(serie, NAN);
+    verificar_rejeitado(serie, 1e-6f);
+    verificar_rejeitado(serie, 1e13f);
+}
+
+int main(void) {
+    testar_serie(SERIE_E24);
+    testar_serie(SERIE_E96);
+    testar_serie(SERIE_E192);
+
+    // Série inválida
+    codigo_resistor_t c;
+    VERIFICAR(!codificar_resistor(100.0f, NUM_SERIES, &c), "serie invalida aceita");
+    VERIFICAR(nome_cor(COR_NENHUMA)[0] == '-', "nome de cor invalida");
+
+    return finalizar_teste("codigo_cores");
+}
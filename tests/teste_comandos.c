@@ -0,0 +1,184 @@
+// Teste no host do interpretador de comandos da serial: uma sessão roteirizada
+// passa caractere a caractere pelo leitor de linha e confere resultado,
+// resposta e configuração pendente a cada passo.
+#include <math.h>
+#include <string.h>
+#include "comandos.h"
+#include "codigo_cores.h"
+#include "teste.h"
+
+#define SEM_LINHA (-1) // O leitor não deve entregar linha nenhuma
+
+typedef struct {
+    const char *entrada;   // Caracteres enviados, incluindo o fim de linha
+    int resultado;         // resultado_comando_t esperado ou SEM_LINHA
+    const char *resposta;  // Resposta exata (NULL: não confere o texto)
+} passo_t;
+
+static const passo_t SESSAO[] = {
+    // Ajuda e consulta
+    {"help\r\n", COMANDO_CONSULTA, NULL},
+    {"?\n", COMANDO_CONSULTA, NULL},
+    {"help amostras\n", COMANDO_ERRO, "erro: comando desconhecido 'help'"},
+    {"get amostras\n", COMANDO_CONSULTA, "amostras=100"},
+    {"get amostras\r", COMANDO_CONSULTA, "amostras=100"}, // Enter de PuTTY/minicom/picocom
+    {"GET Serie\n", COMANDO_CONSULTA, "serie=E24"},
+    {"get xyz\n", COMANDO_ERRO, "erro: parametro desconhecido 'xyz'"},
+    {"get amostras serie\n", COMANDO_ERRO, "erro: uso get [parametro]"},
+
+    // Alterações válidas (o leitor converte para minúsculas)
+    {"set amostras 250\n", COMANDO_ALTERADO, "ok amostras=250"},
+    {"SET Serie E96\r\n", COMANDO_ALTERADO, "ok serie=E96"},
+    {"set rconhecido 4.7e3\n", COMANDO_ALTERADO, "ok rconhecido=4700"},
+    {"set limite 1e6\n", COMANDO_ALTERADO, "ok limite=1000000"},
+    {"set intervalo 10000\n", COMANDO_ALTERADO, "ok intervalo=10000"},
+    {"set perfil economico\n", COMANDO_ALTERADO, "ok perfil=economico"},
+    {"set modo grafico\n", COMANDO_ALTERADO, "ok modo=grafico"},
+    {"  set   amostras\t1000  \n", COMANDO_ALTERADO, "ok amostras=1000"},
+
+    // Valores fora dos limites ou malformados
+    {"set amostras 0\n", COMANDO_ERRO, "erro: valor invalido '0' para amostras"},
+    {"set amostras 1001\n", COMANDO_ERRO, "erro: valor invalido '1001' para amostras"},
+    {"set amostras -5\n", COMANDO_ERRO, "erro: valor invalido '-5' para amostras"},
+    {"set amostras 1e2\n", COMANDO_ERRO, "erro: valor invalido '1e2' para amostras"},
+    {"set amostras 99999999999999999999\n", COMANDO_ERRO, NULL},
+    {"set serie e12\n", COMANDO_ERRO, "erro: valor invalido 'e12' para serie"},
+    {"set rconhecido abc\n", COMANDO_ERRO, "erro: valor invalido 'abc' para rconhecido"},
+    {"set rconhecido 10k\n", COMANDO_ERRO, "erro: valor invalido '10k' para rconhecido"},
+    {"set rconhecido 0.5\n", COMANDO_ERRO, "erro: valor invalido '0.5' para rconhecido"},
+    {"set limite -5\n", COMANDO_ERRO, "erro: valor invalido '-5' para limite"},
+    {"set intervalo 10001\n", COMANDO_ERRO, "erro: valor invalido '10001' para intervalo"},
+    {"set perfil turbo\n", COMANDO_ERRO, "erro: valor invalido 'turbo' para perfil"},
+    {"set modo 1\n", COMANDO_ERRO, "erro: valor invalido '1' para modo"},
+
+    // nan/inf passam pelo strtof e precisam ser barrados pelos limites
+    {"set rconhecido nan\n", COMANDO_ERRO, "erro: valor invalido 'nan' para rconhecido"},
+    {"set rconhecido inf\n", COMANDO_ERRO, "erro: valor invalido 'inf' para rconhecido"},
+    {"set rconhecido 1e400\n", COMANDO_ERRO, "erro: valor invalido '1e400' para rconhecido"},
+    {"set limite NaN\n", COMANDO_ERRO, "erro: valor invalido 'nan' para limite"},
+    {"set limite infinity\n", COMANDO_ERRO, "erro: valor invalido 'infinity' para limite"},
+    {"set limite -inf\n", COMANDO_ERRO, "erro: valor invalido '-inf' para limite"},
+
+    // Sintaxe
+    {"set amostras\n", COMANDO_ERRO, "erro: uso set <parametro> <valor>"},
+    {"set amostras 5 6\n", COMANDO_ERRO, "erro: uso set <parametro> <valor>"},
+    {"set xyz 5\n", COMANDO_ERRO, "erro: parametro desconhecido 'xyz'"},
+    {"foo\n", COMANDO_ERRO, "erro: comando desconhecido 'foo'"},
+    {"save agora\n", COMANDO_ERRO, "erro: comando desconhecido 'save'"},
+    {"   \n", COMANDO_ERRO, "erro: linha vazia"},
+
+    // Fins de linha seguidos: só o primeiro entrega a linha, os demais chegam vazios
+    {"get serie\r\r\n\n", COMANDO_CONSULTA, "serie=E96"},
+
+    // Linhas vazias e caracteres de controle não geram linha
+    {"\n", SEM_LINHA, NULL},
+    {"\r\n", SEM_LINHA, NULL},
+    {"\x1b\x01\n", SEM_LINHA, NULL},
+
+    // Backspace (BS e DEL) e edição além do início da linha
+    {"set amostras 12\b3\n", COMANDO_ALTERADO, "ok amostras=13"},
+    {"\b\b\x7fget amostraz\x7fs\n", COMANDO_CONSULTA, "amostras=13"},
+    {"get am\tostras\n", COMANDO_ERRO, "erro: uso get [parametro]"}, // Tab separa tokens
+    {"xyz\b\b\bget intervalo\n", COMANDO_CONSULTA, "intervalo=10000"},
+
+    // Linha longa demais: descartada inteira, inclusive um "set" válido no início
+    {"set amostras 7                                                      fim\n", SEM_LINHA, NULL},
+    {"get amostras\n", COMANDO_CONSULTA, "amostras=13"},
+    {"set amostras 7                                                      fim\r\n", SEM_LINHA, NULL},
+    {"get amostras\r\n", COMANDO_CONSULTA, "amostras=13"},
+    // Limite exato: 63 caracteres cabem, 64 não
+    {"get amostras                                                   \n", COMANDO_CONSULTA, "amostras=13"},
+    {"get amostras                                                    \n", SEM_LINHA, NULL},
+
+    // Gravação
+    {"save\n", COMANDO_SALVAR, "ok gravando"},
+};
+
+static bool configuracoes_iguais(const configuracao_t *a, const configuracao_t *b) {
+    return a->num_amostras == b->num_amostras && a->serie == b->serie &&
+           a->perfil == b->perfil && a->modo_grafico == b->modo_grafico &&
+           a->resistor_conhecido == b->resistor_conhecido &&
+           a->limite_aberto == b->limite_aberto && a->intervalo_ms == b->intervalo_ms;
+}
+
+// Envia os caracteres de uma entrada; retorna o resultado da linha entregue
+// (ou SEM_LINHA) e verifica que cada entrada gera no máximo uma linha
+static int enviar(leitor_linha_t *leitor, const char *entrada, configuracao_t *cfg,
+                  char *resposta, size_t tamanho) {
+    int resultado = SEM_LINHA;
+    resposta[0] = '\0';
+    for (const char *p = entrada; *p; ++p) {
+        if (leitor_adicionar(leitor, (unsigned char)*p)) {
+            VERIFICAR(resultado == SEM_LINHA, "'%s': mais de uma linha entregue", entrada);
+            resultado = executar_comando(leitor->linha, cfg, resposta, tamanho);
+        }
+    }
+    return resultado;
+}
+
+static void testar_sessao(void) {
+    configuracao_t cfg;
+    configuracao_padrao(&cfg);
+    leitor_linha_t leitor;
+    leitor_iniciar(&leitor);
+    char resposta[160];
+
+    for (size_t i = 0; i < sizeof(SESSAO) / sizeof(SESSAO[0]); ++i) {
+        const passo_t *passo = &SESSAO[i];
+        configuracao_t antes = cfg;
+        int resultado = enviar(&leitor, passo->entrada, &cfg, resposta, sizeof(resposta));
+
+        VERIFICAR(resultado == passo->resultado, "passo %zu: resultado %d, esperado %d (%s)",
+                  i, resultado, passo->resultado, resposta);
+        if (passo->resposta != NULL) {
+            VERIFICAR(strcmp(resposta, passo->resposta) == 0, "passo %zu: resposta '%s', esperado '%s'",
+                      i, resposta, passo->resposta);
+        }
+        if (resultado != COMANDO_ALTERADO) { // Erros e consultas não mexem na pendente
+            VERIFICAR(configuracoes_iguais(&antes, &cfg), "passo %zu: configuracao alterada", i);
+        }
+        VERIFICAR(configuracao_valida(&cfg), "passo %zu: configuracao invalida", i);
+    }
+
+    // Estado final da sessão
+    VERIFICAR(cfg.num_amostras == 13 && cfg.serie == SERIE_E96 && cfg.perfil == PERFIL_ECONOMICO &&
+              cfg.modo_grafico == 1 && cfg.resistor_conhecido == 4700.0f &&
+              cfg.limite_aberto == 1e6f && cfg.intervalo_ms == 10000,
+              "estado final da sessao");
+
+    // "get" sem parâmetro lista todos e cabe na resposta
+    VERIFICAR(enviar(&leitor, "get\n", &cfg, resposta, sizeof(resposta)) == COMANDO_CONSULTA, "get");
+    VERIFICAR(strcmp(resposta, "amostras=13 rconhecido=4700 serie=E96 limite=1000000 "
+                               "intervalo=10000 perfil=economico modo=grafico") == 0,
+              "get: '%s'", resposta);
+
+    // Resposta truncada num buffer pequeno continua terminada em '\0'
+    char pequena[16];
+    memset(pequena, 'x', sizeof(pequena));
+    VERIFICAR(enviar(&leitor, "get\n", &cfg, pequena, sizeof(pequena)) == COMANDO_CONSULTA, "get curto");
+    VERIFICAR(memchr(pequena, '\0', sizeof(pequena)) != NULL, "get curto sem terminador");
+
+    // "padrao" volta exatamente aos valores de boot, incluindo PERFIL_INICIAL
+    // e a cadência dele
+    VERIFICAR(enviar(&leitor, "padrao\n", &cfg, resposta, sizeof(resposta)) == COMANDO_ALTERADO, "padrao");
+    configuracao_t fabrica;
+    configuracao_padrao(&fabrica);
+    VERIFICAR(configuracoes_iguais(&cfg, &fabrica), "padrao difere de configuracao_padrao");
+    VERIFICAR(cfg.perfil == PERFIL_INICIAL, "padrao: perfil %d, esperado %d", cfg.perfil, PERFIL_INICIAL);
+    VERIFICAR(cfg.intervalo_ms == intervalo_padrao_ms(PERFIL_INICIAL), "padrao: intervalo %lu",
+              (unsigned long)cfg.intervalo_ms);
+    VERIFICAR(enviar(&leitor, "padrao agora\n", &cfg, resposta, sizeof(resposta)) == COMANDO_ERRO,
+              "padrao com argumento");
+}
+
+int main(void) {
+    testar_sessao();
+
+    // Cadência de fábrica por perfil
+    VERIFICAR(intervalo_padrao_ms(PERFIL_RAPIDO) == 0, "cadencia rapido");
+    VERIFICAR(intervalo_padrao_ms(PERFIL_EQUILIBRADO) == 200, "cadencia equilibrado");
+    VERIFICAR(intervalo_padrao_ms(PERFIL_ECONOMICO) == 500, "cadencia economico");
+    VERIFICAR(intervalo_padrao_ms(NUM_PERFIS) == 0, "cadencia de perfil invalido");
+
+    return finalizar_teste("comandos");
+}
@@ -0,0 +1,89 @@
+// Teste no host da média e variância incrementais (Welford), comparadas com
+// o cálculo em duas passadas em double
+#include <math.h>
+#include <stdint.h>
+#include "estatistica.h"
+#include "teste.h"
+
+// Referência em duas passadas
+static void referencia(const float *v, int n, double *media, double *variancia) {
+    double soma = 0;
+    for (int i = 0; i < n; ++i) {
+        soma += v[i];
+    }
+    *media = soma / n;
+    double m2 = 0;
+    for (int i = 0; i < n; ++i) {
+        m2 += (v[i] - *media) * (v[i] - *media);
+    }
+    *variancia = n > 1 ? m2 / (n - 1) : 0;
+}
+
+static void verificar_bloco(const char *nome, const float *v, int n, double tol_rel) {
+    estatistica_t est;
+    estatistica_iniciar(&est);
+    for (int i = 0; i < n; ++i) {
+        estatistica_adicionar(&est, v[i]);
+    }
+
+    double media, variancia;
+    referencia(v, n, &media, &variancia);
+    double incerteza = n > 1 ? sqrt(variancia / n) : 0;
+
+    VERIFICAR(est.n == (uint32_t)n, "%s: n = %u", nome, (unsigned)est.n);
+    VERIFICAR(fabs(est.media - media) <= fabs(media) * 1e-6 + 1e-6,
+              "%s: media %g, esperado %g", nome, est.media, media);
+    VERIFICAR(fabs(estatistica_variancia(&est) - variancia) <= variancia * tol_rel + 1e-6,
+              "%s: variancia %g, esperado %g", nome, estatistica_variancia(&est), variancia);
+    VERIFICAR(fabs(estatistica_incerteza_media(&est) - incerteza) <= incerteza * tol_rel + 1e-6,
+              "%s: incerteza %g, esperado %g", nome, estatistica_incerteza_media(&est), incerteza);
+}
+
+int main(void) {
+    // Sem amostras e com uma só: variância e incerteza nulas
+    estatistica_t est;
+    estatistica_iniciar(&est);
+    VERIFICAR(est.n == 0 && estatistica_variancia(&est) == 0.0f, "bloco vazio");
+    VERIFICAR(estatistica_incerteza_media(&est) == 0.0f, "incerteza do bloco vazio");
+    estatistica_adicionar(&est, 1234.0f);
+    VERIFICAR(est.media == 1234.0f, "media de uma amostra");
+    VERIFICAR(estatistica_variancia(&est) == 0.0f, "variancia de uma amostra");
+    VERIFICAR(estatistica_incerteza_media(&est) == 0.0f, "incerteza de uma amostra");
+
+    // Exemplo clássico: média 5, variância amostral 32/7
+    static const float classico[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    verificar_bloco("classico", classico, 8, 1e-6);
+    estatistica_iniciar(&est);
+    for (int i = 0; i < 8; ++i) {
+        estatistica_adicionar(&est, classico[i]);
+    }
+    VERIFICAR(est.media == 5.0f, "classico: media %g", est.media);
+    VERIFICAR(fabsf(estatistica_variancia(&est) - 32.0f / 7.0f) < 1e-5f,
+              "classico: variancia %g", estatistica_variancia(&est));
+
+    // Leituras constantes: variância exatamente zero
+    static float constantes[500];
+    for (int i = 0; i < 500; ++i) {
+        constantes[i] = 2048.0f;
+    }
+    verificar_bloco("constantes", constantes, 500, 0);
+
+    // Bloco típico do ADC: média alta e pouco ruído, onde a soma dos
+    // quadrados em float perderia todos os dígitos da variância
+    static float adc[1000];
+    uint32_t semente = 12345;
+    for (int i = 0; i < 1000; ++i) {
+        semente = semente * 1664525u + 1013904223u;
+        adc[i] = 4000.0f + (float)((semente >> 16) % 7) - 3.0f;
+    }
+    verificar_bloco("adc", adc, 1000, 1e-3);
+
+    // Resistências grandes com desvio relativo pequeno
+    static float resistencias[200];
+    for (int i = 0; i < 200; ++i) {
+        resistencias[i] = 1.0e6f + (float)((i * 37) % 11 - 5) * 10.0f;
+    }
+    verificar_bloco("resistencias", resistencias, 200, 1e-3);
+
+    return finalizar_teste("estatistica");
+}
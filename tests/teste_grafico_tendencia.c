@@ -0,0 +1,280 @@
+// Teste no host do gráfico de tendência com um modelo do SSD1306 no lugar do
+// I2C: decodifica comandos e escritas em janela (endereçamento horizontal) e
+// conta bytes e tempo de barramento a 400 kHz. Compilado para 128x64, 128x32
+// e geometria em tempo de execução.
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "grafico_tendencia.c" // Acesso às funções internas (redesenho de referência)
+#include "teste.h"
+
+#ifdef SSD1306_FIXED
+#define ALTURA SSD1306_HEIGHT
+#else
+#define ALTURA 64
+#endif
+#define LARGURA 128
+#define PAGINAS (ALTURA / 8)
+#define PAGINA_GRAFICO 2 // Mesma divisão do main.c
+#define BAUD_I2C 400000.0
+
+// Bytes no barramento (endereço incluído) de uma janela de n colunas na faixa:
+// 6 comandos de endereçamento + uma transação de dados
+#define BYTES_JANELA(n) (6 * 3 + 2 + (n) * (PAGINAS - PAGINA_GRAFICO))
+
+// --- Modelo do controlador ---
+
+typedef struct {
+    uint8_t gddram[8][LARGURA];
+
+    // Janela de escrita
+    uint8_t col0, col1, pag0, pag1, col, pag;
+
+    // Decodificação de comandos com argumentos
+    uint8_t comando;
+    uint8_t args[6];
+    uint8_t num_args, esperados;
+
+    uint32_t bytes;  // Bytes no barramento, endereço incluído
+    bool rolagem;    // Algum comando de rolagem (0x26/0x27/0x29/0x2A/0x2F)
+    bool desligado;  // Ignora o barramento (redesenho de referência)
+} controlador_t;
+
+static controlador_t ctl;
+
+static void executar_comando_modelo(uint8_t c) {
+    const uint8_t *a = ctl.args;
+    switch (c) {
+    case 0x21: ctl.col0 = a[0]; ctl.col1 = a[1]; ctl.col = a[0]; break;
+    case 0x22: ctl.pag0 = a[0]; ctl.pag1 = a[1]; ctl.pag = a[0]; break;
+    case 0x26: case 0x27: case 0x29: case 0x2A: case 0x2F: ctl.rolagem = true; break;
+    default: break;
+    }
+}
+
+static uint8_t argumentos_comando(uint8_t c) {
+    switch (c) {
+    case 0x21: case 0x22: return 2;
+    case 0x26: case 0x27: return 6;
+    case 0x29: case 0x2A: return 5;
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB: return 1;
+    default: return 0;
+    }
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)i2c;
+    (void)addr;
+    (void)nostop;
+    if (ctl.desligado) {
+        return (int)len;
+    }
+    ctl.bytes += len + 1; // Endereço + dados
+
+    if (src[0] == 0x80 && len == 2) { // Comando
+        uint8_t b = src[1];
+        if (ctl.esperados > 0) {
+            ctl.args[ctl.num_args++] = b;
+            if (ctl.num_args == ctl.esperados) {
+                ctl.esperados = 0;
+                executar_comando_modelo(ctl.comando);
+            }
+        } else {
+            ctl.comando = b;
+            ctl.num_args = 0;
+            ctl.esperados = argumentos_comando(b);
+            if (ctl.esperados == 0) {
+                executar_comando_modelo(b);
+            }
+        }
+    } else if (src[0] == 0x40) { // Dados na janela atual
+        for (size_t i = 1; i < len; ++i) {
+            ctl.gddram[ctl.pag][ctl.col] = src[i];
+            if (ctl.col == ctl.col1) {
+                ctl.col = ctl.col0;
+                ctl.pag = (ctl.pag == ctl.pag1) ? ctl.pag0 : ctl.pag + 1;
+            } else {
+                ctl.col++;
+            }
+        }
+    } else {
+        VERIFICAR(false, "prefixo I2C invalido 0x%02X", src[0]);
+    }
+    return (int)len;
+}
+
+// --- Auxiliares ---
+
+static ssd1306_t oled;
+
+static void iniciar_modelo(void) {
+    memset(&ctl, 0, sizeof(ctl));
+    ssd1306_init(&oled, LARGURA, ALTURA, false, 0x3C, NULL);
+    ssd1306_config(&oled);
+    ssd1306_fill(&oled, false);
+    ssd1306_send_data(&oled);
+}
+
+static bool gddram_igual_buffer(void) {
+    for (uint8_t p = 0; p < PAGINAS; ++p) {
+        if (memcmp(ctl.gddram[p], &oled.ram_buffer[p * LARGURA + 1], LARGURA) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A faixa na tela deve ser igual a um redesenho completo das mesmas colunas
+static bool faixa_igual_redesenho(const grafico_tendencia_t *g) {
+    static uint8_t buffer_ref[PAGINAS * LARGURA + 1];
+    ssd1306_t ref = oled;
+    ref.ram_buffer = buffer_ref;
+    grafico_tendencia_t copia = *g;
+    copia.ssd = &ref;
+
+    ctl.desligado = true;
+    redesenhar_faixa(&copia);
+    ctl.desligado = false;
+
+    for (uint8_t p = g->pagina_inicio; p <= g->pagina_fim; ++p) {
+        if (memcmp(ctl.gddram[p], &buffer_ref[p * LARGURA + 1], LARGURA) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --- Testes ---
+
+// Janelas estreitas vão em uma só transação de dados; a faixa inteira
+// é dividida em transações de até 128 bytes
+static void testar_envio_janela(void) {
+    iniciar_modelo();
+    for (uint16_t i = 1; i < oled.bufsize; ++i) {
+        oled.ram_buffer[i] = (uint8_t)(i * 37);
+    }
+
+    uint32_t inicio = ctl.bytes;
+    ssd1306_send_area(&oled, 10, 12, PAGINA_GRAFICO, PAGINAS - 1);
+    VERIFICAR(ctl.bytes - inicio == BYTES_JANELA(3), "janela de 3 colunas: %u bytes",
+              (unsigned)(ctl.bytes - inicio));
+
+    ssd1306_send_area(&oled, 0, LARGURA - 1, 0, PAGINAS - 1);
+    VERIFICAR(gddram_igual_buffer(), "tela inteira diverge do buffer");
+}
+
+// Sequência de leituras com recentragem, invalidação, 0 ohm, volta do cursor
+// da borda direita para a esquerda e valores não finitos. O gráfico nunca usa
+// a rolagem por hardware, a GDDRAM segue o buffer e, sem mudança de escala,
+// cada leitura envia só a coluna nova e a lacuna à frente dela.
+static void testar_sequencia(void) {
+    iniciar_modelo();
+    grafico_tendencia_t g;
+    grafico_iniciar(&g, &oled, PAGINA_GRAFICO);
+    VERIFICAR(g.pagina_fim == PAGINAS - 1, "pagina_fim %d", g.pagina_fim);
+
+    srand(1);
+    uint32_t pior_bytes = 0, total_bytes = 0, incrementais = 0, voltas = 0;
+    for (int n = 0; n < 700; ++n) {
+        float valor;
+        if (n < 250) {
+            valor = 4700.0f * (1.0f + 0.02f * sinf(n * 0.1f)) + (rand() % 100 - 50);
+        } else if (n < 400) {
+            valor = 10000.0f + (rand() % 300 - 150);
+        } else if (n < 550) {
+            valor = (n % 3 == 1) ? 0.0f : (rand() % 7 - 3) * 0.1f; // Curto: 0 ohm e ruído
+        } else {
+            valor = 1000.0f + (rand() % 20 - 10);
+        }
+
+        bool invalidado = (n == 300);
+        if (invalidado) { // Tela cheia (ex.: circuito aberto) e volta ao gráfico
+            ssd1306_fill(&oled, false);
+            ssd1306_draw_string(&oled, "Aberto", 8, 8, false);
+            ssd1306_send_data(&oled);
+            grafico_invalidar(&g);
+        }
+
+        uint8_t x = g.cursor;
+        float centro = g.centro;
+        uint32_t inicio = ctl.bytes;
+        grafico_adicionar(&g, valor);
+        uint32_t bytes = ctl.bytes - inicio;
+
+        VERIFICAR(!ctl.rolagem, "n=%d: rolagem por hardware usada", n);
+        VERIFICAR(isfinite(g.centro), "n=%d: centro nao finito", n);
+        VERIFICAR(g.colunas[x].valor == valor && g.cursor == (x + 1) % LARGURA,
+                  "n=%d: leitura fora da coluna %d", n, x);
+        for (uint8_t k = 1; k <= GRAFICO_LACUNA; ++k) {
+            VERIFICAR(isnan(g.colunas[(x + k) % LARGURA].valor), "n=%d: lacuna +%d ocupada", n, k);
+        }
+        VERIFICAR(gddram_igual_buffer(), "n=%d: GDDRAM diverge do buffer", n);
+        VERIFICAR(faixa_igual_redesenho(&g), "n=%d: faixa diverge do redesenho", n);
+
+        // Sem redesenho: uma janela de LACUNA + 1 colunas, ou duas na volta
+        if (n > 0 && !invalidado && g.centro == centro) {
+            bool volta = (x + GRAFICO_LACUNA >= LARGURA);
+            uint32_t esperado = volta ? BYTES_JANELA(LARGURA - x) + BYTES_JANELA(x + GRAFICO_LACUNA + 1 - LARGURA)
+                                      : BYTES_JANELA(GRAFICO_LACUNA + 1);
+            VERIFICAR(bytes == esperado, "n=%d: %u bytes, esperado %u", n, (unsigned)bytes, (unsigned)esperado);
+            if (bytes > pior_bytes) {
+                pior_bytes = bytes;
+            }
+            total_bytes += bytes;
+            incrementais++;
+            voltas += volta;
+        }
+        if (falhas_teste > 20) {
+            return;
+        }
+
+        // Com o centro em 0 ohm (n = 400), o ruído do curto fica dentro da escala
+        if (n >= 400 && n < 550) {
+            VERIFICAR(g.centro == 0.0f, "n=%d: recentrou em %g", n, g.centro);
+        }
+    }
+    VERIFICAR(voltas > 0, "cursor nunca voltou da borda");
+    printf("leitura sem mudanca de escala: %.1f bytes em media, pior %u bytes (%.2f ms a 400 kHz)\n",
+           (double)total_bytes / incrementais, (unsigned)pior_bytes, pior_bytes * 9 * 1e3 / BAUD_I2C);
+
+    // Leituras não finitas não entram nas colunas nem geram tráfego
+    uint8_t cursor = g.cursor;
+    float ultimo = g.ultimo_valor;
+    uint32_t inicio = ctl.bytes;
+    grafico_adicionar(&g, NAN);
+    grafico_adicionar(&g, INFINITY);
+    VERIFICAR(g.cursor == cursor && g.ultimo_valor == ultimo, "leitura nao finita registrada");
+    VERIFICAR(ctl.bytes == inicio, "leitura nao finita enviada");
+}
+
+// Escala mínima: com centro 0 a linha sai do meio da faixa, sem NaN
+static void testar_escala_zero(void) {
+    iniciar_modelo();
+    grafico_tendencia_t g;
+    grafico_iniciar(&g, &oled, PAGINA_GRAFICO);
+    grafico_adicionar(&g, 0.0f);
+    int altura = altura_faixa(&g);
+
+    VERIFICAR(g.centro == 0.0f, "centro %g", g.centro);
+    VERIFICAR(!fora_da_escala(&g, GRAFICO_MEIA_FAIXA_MIN), "limite da escala minima");
+    VERIFICAR(fora_da_escala(&g, 2 * GRAFICO_MEIA_FAIXA_MIN), "fora da escala minima");
+    VERIFICAR(valor_para_y(&g, 0.0f) == lroundf((altura - 1) / 2.0f), "0 ohm fora do centro");
+    VERIFICAR(valor_para_y(&g, -1.0f) == altura - 1, "negativo nao satura embaixo");
+    VERIFICAR(valor_para_y(&g, 1.0f) == 0, "positivo nao satura em cima");
+}
+
+int main(void) {
+    testar_envio_janela();
+    testar_sequencia();
+    testar_escala_zero();
+
+    char nome[48];
+#ifdef SSD1306_FIXED
+    snprintf(nome, sizeof(nome), "grafico_tendencia %dx%d", LARGURA, ALTURA);
+#else
+    snprintf(nome, sizeof(nome), "grafico_tendencia %dx%d dinamico", LARGURA, ALTURA);
+#endif
+    return finalizar_teste(nome);
+}